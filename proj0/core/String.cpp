@@ -12,68 +12,139 @@
 
 #include "String.hpp"
 #include "OutOfBoundsException.hpp"
+#include "StringAlgorithms.hpp"
+#include "StringArena.hpp"
+
+
+namespace
+{
+    unsigned int lengthOf(const char* chars) noexcept {
+        unsigned int size = 0;
+        while (chars[size] != '\0') {
+            size++;
+        }
+        return size;
+    }
+
+    void copyChars(char* target, const char* source, unsigned int count) noexcept {
+        for (unsigned int i = 0; i < count; ++i) {
+            target[i] = source[i];
+        }
+    }
+}
+
+
+//The header that sits in front of the characters of every heap buffer.
+//Its reference count is only touched atomically, so Strings that share
+//a buffer from new[] can be copied and destroyed on different threads.
+//arena is the StringArena the buffer came from, or nullptr if it came
+//from new[]; the last release of an arena buffer goes back to the arena,
+//so those must stay on the arena's one thread.
+struct String::SharedBuffer {
+    StringArena * arena;
+    unsigned int references;
+};
 
 
 String::String() {
-    num_chars = 0;
-    characters = new char[1];
-    characters[0] = '\0';
+    becomeEmpty();
 }
 
 String::String(const char *chars) {
-    int size = 0;
-    while (chars[size] != '\0')
-    {
-        size++;
-    }
-    characters = new char[size + 1];
-    for (int i = 0; i <= size; ++i) {
-        characters[i] = chars[i];
-    }
-    characters[size] = '\0';
-    num_chars = size;
+    becomeEmpty();
+    assign(chars, lengthOf(chars));
+}
+
+String::String(StringView view) {
+    becomeEmpty();
+    assign(view.data(), view.length());
 }
 
 String::String(const String &s) {
-    characters = s.characters;
-    num_chars = s.num_chars;
+    becomeEmpty();
+    *this = s;
+}
+
+String::String(String &&s) noexcept {
+    becomeEmpty();
+    *this = static_cast<String&&>(s);
 }
 
 String::~String() noexcept {
-    delete[] characters;
+    release();
 }
 
 String &String::operator=(const String &s) {
-    delete[] characters;
-    num_chars = s.length();
-    
-    characters = new char[num_chars + 1];
-    characters[num_chars] = '\0';
-
-    for (int i = 0; i < num_chars; ++i) {
-        characters[i] = s.characters[i];
+    if (this == &s) {
+        return *this;
+    }
+
+    if (s.isInline() || !s.shareable) {
+        assign(s.characters, s.num_chars);
+    } else {
+        //Long strings share one buffer until either of them is modified
+        __atomic_add_fetch(&bufferOf(s.characters)->references, 1, __ATOMIC_RELAXED);
+        release();
+        characters = s.characters;
+        max_chars = s.max_chars;
+        num_chars = s.num_chars;
+        shareable = true;
     }
 
+    hash_value = s.hash_value;
+    hash_valid = s.hash_valid;
     return *this;
 }
 
-void String::append(const String &s) {
-    unsigned int new_size = num_chars + s.length();
-    char * new_characters = new char[new_size + 1];
-
-    for (int i = 0; i < num_chars; ++i) {
-        new_characters[i] = characters[i];
+String &String::operator=(String &&s) noexcept {
+    if (this == &s) {
+        return *this;
     }
 
-    for (int i = 0; i < s.length(); ++i) {
-        new_characters[i + num_chars] = s.at(i);
+    release();
+    num_chars = s.num_chars;
+    max_chars = s.max_chars;
+    shareable = s.shareable;
+    hash_value = s.hash_value;
+    hash_valid = s.hash_valid;
+
+    if (s.isInline()) {
+        //Short strings have nothing to steal, so their characters are copied
+        characters = inline_characters;
+        copyChars(inline_characters, s.inline_characters, num_chars + 1);
+    } else {
+        characters = s.characters;
     }
 
-    new_characters[new_size] = '\0';
+    s.becomeEmpty();
+    return *this;
+}
 
-    delete[] characters;
-    characters = new_characters;
+void String::append(const String &s) {
+    unsigned int new_size = num_chars + s.num_chars;
+
+    if (new_size > max_chars || isShared()) {
+        //Grow geometrically so that repeated appends are amortized constant time
+        unsigned int new_capacity = max_chars;
+        if (new_size > max_chars) {
+            new_capacity = max_chars * 2;
+            if (new_capacity < new_size) {
+                new_capacity = new_size;
+            }
+        }
+
+        //Allocate before releasing anything, since s may be this string
+        char * new_characters = allocate(new_capacity);
+        copyChars(new_characters, characters, num_chars);
+        copyChars(new_characters + num_chars, s.characters, s.num_chars);
+        adopt(new_characters, new_capacity);
+    } else {
+        copyChars(characters + num_chars, s.characters, s.num_chars);
+    }
+
+    characters[new_size] = '\0';
     num_chars = new_size;
+    hash_valid = false;
 }
 
 char String::at(unsigned int index) const {
@@ -89,128 +160,117 @@ char &String::at(unsigned int index) {
     {
         throw OutOfBoundsException{};
     }
+    //The caller may write through the returned reference at any time from
+    //now on, so the buffer can't be shared with copies made afterward
+    makeUnique();
+    shareable = false;
+    hash_valid = false;
     return characters[index];
 }
 
 void String::clear() {
-    delete[] characters;
-    characters = new char{'\0'};
+    if (isShared()) {
+        release();
+        becomeEmpty();
+        return;
+    }
+
     num_chars = 0;
+    characters[0] = '\0';
+    hash_valid = false;
 }
 
-int String::compareTo(const String &s) const noexcept {
-    for (int i = 0; i < num_chars; ++i) {
-        //Check if this has reached last char of s
-        if (i == s.num_chars) {
-            return 1;
-        }
-        //Check if current char for this is less than s
-        if (characters[i] < s.characters[i]) {
-            return -1;
-        }
-        //Check if current char for this is greater than s
-        if (characters[i] > s.characters[i]) {
-            return 1;
-        }
-    }
+unsigned int String::capacity() const noexcept {
+    return max_chars;
+}
 
-    if (num_chars == s.num_chars) {
-        return 0;
-    } else {
-        return -1;
+void String::reserve(unsigned int newCapacity) {
+    if (newCapacity > max_chars) {
+        reallocate(newCapacity);
     }
 }
 
-String String::concatenate(const String &s) const {
-    unsigned int new_size = num_chars + s.length();
-
-    char * new_characters = new char[new_size + 1];
-
-    for (int i = 0; i < num_chars; ++i) {
-        new_characters[i] = characters[i];
+void String::shrinkToFit() {
+    if (!isInline() && max_chars > num_chars) {
+        reallocate(num_chars);
     }
+}
 
-    for (int i = 0; i < s.length(); ++i) {
-        new_characters[i + num_chars] = s.at(i);
-    }
+int String::compareTo(const String &s) const noexcept {
+    return compareChars(characters, num_chars, s.characters, s.num_chars);
+}
+
+int String::compareTo(StringView v) const noexcept {
+    return compareChars(characters, num_chars, v.data(), v.length());
+}
 
-    new_characters[new_size] = '\0';
+String String::concatenate(const String &s) const {
+    String result;
+    char * result_characters = result.prepare(num_chars + s.num_chars);
 
-    String * to_return = new String();
-    delete[] to_return->characters;
-    to_return->characters = new_characters;
-    to_return->num_chars = new_size;
+    copyChars(result_characters, characters, num_chars);
+    copyChars(result_characters + num_chars, s.characters, s.num_chars);
 
-    return * to_return;
+    return result;
 }
 
 bool String::contains(const String &substring) const noexcept {
-    int compare_index = 0;
-    bool streak = false;
-
-    for (int i = 0; i < num_chars; ++i) {
-        char current_char = characters[i];
-        char current_substr_char = substring.characters[compare_index];
-        
-        if (compare_index + 1 == substring.length() && current_char == current_substr_char) {
-            return true;
-        }
-        if (streak && current_char == current_substr_char) {
-            compare_index++;
-        }
-        if (!streak && current_char == current_substr_char) {
-            compare_index++;
-            streak = true;
-        }
-        if (streak && current_char != current_substr_char) {
-            compare_index = 0;
-            streak = false;
-        }
-    }
-    return false;
+    return find(substring) >= 0;
+}
+
+bool String::contains(StringView substring) const noexcept {
+    return find(substring) >= 0;
 }
 
 bool String::equals(const String &s) const noexcept {
-    if (length() != s.length()) {
+    if (num_chars != s.num_chars) {
         return false;
     }
-
-    for (int i = 0; i < num_chars; ++i) {
-        if (characters[i] != s.characters[i]) {
-            return false;
-        }
+    if (hash_valid && s.hash_valid && hash_value != s.hash_value) {
+        return false;
     }
 
-    return true;
+    return equalChars(characters, s.characters, num_chars);
+}
+
+bool String::equals(StringView v) const noexcept {
+    return num_chars == v.length() && equalChars(characters, v.data(), num_chars);
+}
+
+unsigned int String::hash() const noexcept {
+    if (!hash_valid) {
+        hash_value = hashChars(characters, num_chars);
+        hash_valid = true;
+    }
+    return hash_value;
 }
 
 int String::find(const String &substring) const noexcept {
-    int start_index = -1;
-    int compare_index = 0;
-    bool streak = false;
-
-    for (int i = 0; i < num_chars; ++i) {
-        char current_char = characters[i];
-        char current_substr_char = substring.characters[compare_index];
-        
-        if (compare_index + 1 == substring.length() && current_char == current_substr_char) {
-            return start_index;
-        }
-        if (streak && current_char == current_substr_char) {
-            compare_index++;
-        }
-        if (!streak && current_char == current_substr_char) {
-            compare_index++;
-            streak = true;
-            start_index = i;
-        }
-        if (streak && current_char != current_substr_char) {
-            compare_index = 0;
-            streak = false;
-            start_index = -1;
+    return findChars(characters, num_chars, substring.characters, substring.num_chars);
+}
+
+int String::find(StringView substring) const noexcept {
+    return findChars(characters, num_chars, substring.data(), substring.length());
+}
+
+int String::rfind(const String &substring) const noexcept {
+    return rfindChars(characters, num_chars, substring.characters, substring.num_chars);
+}
+
+unsigned int String::findAll(const String &substring, int *indices, unsigned int maxIndices) const noexcept {
+    unsigned int count = 0;
+    int index = findChars(characters, num_chars, substring.characters, substring.num_chars);
+
+    while (index >= 0) {
+        if (count < maxIndices) {
+            indices[count] = index;
         }
+        count++;
+
+        index = findChars(characters, num_chars, substring.characters, substring.num_chars, index + 1);
     }
-    return start_index;
+
+    return count;
 }
 
 bool String::isEmpty() const noexcept {
@@ -222,43 +282,149 @@ unsigned int String::length() const noexcept {
 }
 
 String String::substring(unsigned int startIndex, unsigned int endIndex) const {
-    if (startIndex < 0 || endIndex >= num_chars) {
+    if (endIndex > num_chars || startIndex > endIndex) {
         throw OutOfBoundsException{};
     }
-    if (startIndex > endIndex) {
-        throw OutOfBoundsException{};
+
+    String result;
+    copyChars(result.prepare(endIndex - startIndex), characters + startIndex, endIndex - startIndex);
+    return result;
+}
+
+StringView String::view() const noexcept {
+    return StringView{characters, num_chars};
+}
+
+StringView String::view(unsigned int startIndex, unsigned int endIndex) const {
+    return view().substring(startIndex, endIndex);
+}
+
+const char *String::toChars() const noexcept {
+    return characters;
+}
+
+bool String::isInline() const noexcept {
+    return characters == inline_characters;
+}
+
+bool String::isShared() const noexcept {
+    return !isInline()
+        && __atomic_load_n(&bufferOf(characters)->references, __ATOMIC_ACQUIRE) > 1;
+}
+
+String::SharedBuffer * String::bufferOf(char *chars) noexcept {
+    return reinterpret_cast<SharedBuffer*>(chars) - 1;
+}
+
+//Returns the number of SharedBuffer-sized blocks needed for a buffer
+//with room for capacity characters plus the terminator
+unsigned int String::blocksFor(unsigned int capacity) noexcept {
+    return 1 + (capacity + sizeof(SharedBuffer)) / sizeof(SharedBuffer);
+}
+
+//Allocates a heap buffer with room for capacity characters plus the
+//terminator, owned by one string, and returns where its characters go.
+//The buffer comes from this thread's current StringArena when there is
+//one and the buffer is small enough for it.
+char * String::allocate(unsigned int capacity) {
+    unsigned int blocks = blocksFor(capacity);
+    StringArena * arena = StringArena::current();
+
+    SharedBuffer * buffer;
+    if (arena != nullptr && blocks * sizeof(SharedBuffer) <= StringArena::LARGEST_ALLOCATION) {
+        buffer = static_cast<SharedBuffer*>(arena->allocate(blocks * sizeof(SharedBuffer)));
+    } else {
+        buffer = new SharedBuffer[blocks];
+        arena = nullptr;
     }
-    if (startIndex == endIndex) {
-        return "";
+
+    buffer->arena = arena;
+    buffer->references = 1;
+
+    return reinterpret_cast<char*>(buffer + 1);
+}
+
+void String::release() noexcept {
+    if (isInline()) {
+        return;
     }
 
-    String * new_substring = new String();
-    new_substring->num_chars = endIndex - startIndex;
-    delete[] new_substring->characters;
-    char * new_characters = new char[num_chars + 1];
-    new_characters[num_chars] = '\0';
-    new_substring->characters = new_characters;
+    SharedBuffer * buffer = bufferOf(characters);
 
-    for (int i = startIndex; i < endIndex; ++i) {
-        new_substring->characters[i - startIndex] = characters[i];
+    if (__atomic_sub_fetch(&buffer->references, 1, __ATOMIC_ACQ_REL) == 0) {
+        if (buffer->arena != nullptr) {
+            buffer->arena->deallocate(buffer, blocksFor(max_chars) * sizeof(SharedBuffer));
+        } else {
+            delete[] buffer;
+        }
     }
+}
 
-    return * new_substring;
+//Switches to a newly-allocated buffer, letting go of the current one
+void String::adopt(char *new_characters, unsigned int capacity) noexcept {
+    release();
+    characters = new_characters;
+    max_chars = capacity;
+    shareable = true;
 }
 
-const char *String::toChars() const noexcept {
-    char * toReturn = new char[num_chars + 1];
-    for (int i = 0; i < num_chars; ++i) {
-        toReturn[i] = characters[i];
+void String::makeUnique() {
+    if (isShared()) {
+        reallocate(max_chars);
     }
-    toReturn[num_chars] = '\0';
-    return toReturn;
 }
 
+void String::becomeEmpty() noexcept {
+    num_chars = 0;
+    max_chars = INLINE_CAPACITY;
+    characters = inline_characters;
+    inline_characters[0] = '\0';
+    shareable = true;
+    hash_valid = false;
+}
 
+//Gives an empty string room for exactly size characters (plus the
+//terminator) and returns where they should be written
+char * String::prepare(unsigned int size) {
+    if (size > INLINE_CAPACITY) {
+        adopt(allocate(size), size);
+    }
+    characters[size] = '\0';
+    num_chars = size;
+    return characters;
+}
 
+//Moves the characters into storage with room for exactly newCapacity
+//characters, which is the inline buffer whenever they fit there
+void String::reallocate(unsigned int newCapacity) {
+    if (newCapacity <= INLINE_CAPACITY) {
+        if (!isInline()) {
+            copyChars(inline_characters, characters, num_chars + 1);
+            release();
+            characters = inline_characters;
+            max_chars = INLINE_CAPACITY;
+            shareable = true;
+        }
+        return;
+    }
 
+    char * new_characters = allocate(newCapacity);
+    copyChars(new_characters, characters, num_chars + 1);
+    adopt(new_characters, newCapacity);
+}
 
+void String::assign(const char *chars, unsigned int size) {
+    if (isShared()) {
+        release();
+        becomeEmpty();
+    }
 
+    if (size > max_chars) {
+        adopt(allocate(size), size);
+    }
 
-
+    copyChars(characters, chars, size);
+    characters[size] = '\0';
+    num_chars = size;
+    hash_valid = false;
+}
@@ -26,6 +26,7 @@
 #ifndef STRING_HPP
 #define STRING_HPP
 
+#include "StringView.hpp"
 
 
 class String
@@ -39,23 +40,45 @@ public:
     // given C-style string, which is assumed to be null-terminated.
     String(const char* chars);
 
+    // Initializes a string to contain a copy of the characters
+    // in the given view.
+    explicit String(StringView view);
+
     // Initializes a string to be a copy of an existing string,
     // meaning that it contains the same characters and has the
-    // same length.
+    // same length.  Long strings aren't actually copied; the two
+    // share the same characters until one of them is modified,
+    // at which point that one makes its own copy.  Copies that
+    // share heap-allocated characters can be copied and destroyed
+    // on different threads.  That's not true of characters that
+    // came from a StringArena, which only one thread may use.
     String(const String& s);
 
+    // Initializes a string by taking over the characters of an
+    // expiring one, which is left empty.  No characters are copied
+    // unless the expiring string is short enough to be stored inline.
+    String(String&& s) noexcept;
+
     // Destroys a string, releasing any memory that is being
     // managed by this object.
     ~String() noexcept;
 
     // Assigns an existing string into this one, replacing the
     // contents of this string with a copy of the contents of
-    // the other.
+    // the other.  As with copy construction, long strings end
+    // up sharing their characters until one is modified.
     String& operator=(const String& s);
 
+    // Assigns an expiring string into this one, taking over its
+    // characters and leaving it empty.
+    String& operator=(String&& s) noexcept;
+
     // append() modifies this string so that it contains all
     // of the characters it currently contains, followed by
-    // all of the characters of s.
+    // all of the characters of s.  When more room is needed,
+    // the capacity at least doubles, so a sequence of appends
+    // copies each character a constant number of times on
+    // average.
     void append(const String& s);
 
     // at() returns one of the characters in the string, given
@@ -72,16 +95,31 @@ public:
     char at(unsigned int index) const;
     char& at(unsigned int index);
 
-    // clear() makes this string be empty.
+    // clear() makes this string be empty.  Its capacity is kept, so
+    // that a string can be cleared and refilled without reallocating.
     void clear();
 
+    // capacity() returns the number of characters this string can hold
+    // before append() has to allocate more memory.
+    unsigned int capacity() const noexcept;
+
+    // reserve() makes sure this string can hold at least the given
+    // number of characters without allocating again.  It never shrinks
+    // the string's capacity.
+    void reserve(unsigned int newCapacity);
+
+    // shrinkToFit() releases whatever capacity this string has beyond
+    // the characters it currently contains.
+    void shrinkToFit();
+
     // compareTo() compares the contents of this string to the
-    // contents of another string lexicographically, returning
+    // contents of another string (or view) lexicographically, returning
     // zero if they're exactly equal, a negative value if this
     // string is "less than" the other one lexicographically,
     // or a positive value if this string is "greater than"
     // the other one lexicographically.
     int compareTo(const String& s) const noexcept;
+    int compareTo(StringView v) const noexcept;
 
     // concatenate() returns a string that contains the
     // characters in this string followed by the characters
@@ -93,15 +131,43 @@ public:
     // happy today?" contains the substring "Boo"), or false
     // otherwise.
     bool contains(const String& substring) const noexcept;
+    bool contains(StringView substring) const noexcept;
 
     // equals() returns true if this string is equivalent to
     // the given string (i.e., they both have the same length
-    // and contain the same sequence of characters).
+    // and contain the same sequence of characters).  Strings
+    // of different lengths, or whose hashes have both been
+    // computed and differ, are rejected without looking at
+    // their characters.
     bool equals(const String& s) const noexcept;
+    bool equals(StringView v) const noexcept;
+
+    // hash() returns a hash of this string's characters.  It's computed
+    // the first time it's asked for and remembered until the string is
+    // modified, so asking again is cheap.  Because remembering it
+    // modifies the string, hash() and equals() must not be called on
+    // the same string from two threads at once.
+    unsigned int hash() const noexcept;
 
     // find() returns the index where the given substring is
-    // found within this string, or -1 if it's not found.
+    // found within this string, or -1 if it's not found.  If
+    // the substring occurs more than once, the index of the
+    // first occurrence is returned.
     int find(const String& substring) const noexcept;
+    int find(StringView substring) const noexcept;
+
+    // rfind() returns the index of the last occurrence of the
+    // given substring within this string, or -1 if it's not
+    // found.
+    int rfind(const String& substring) const noexcept;
+
+    // findAll() finds every occurrence of the given substring
+    // within this string, including ones that overlap, and
+    // returns how many there are.  The indices of the first
+    // maxIndices of them are stored into indices, in ascending
+    // order, so callers can count first and then collect.
+    unsigned int findAll(
+        const String& substring, int* indices, unsigned int maxIndices) const noexcept;
 
     // isEmpty() returns true if this string is empty, or
     // false otherwise.
@@ -117,6 +183,15 @@ public:
     // substring(7, 12) would return "happy".
     String substring(unsigned int startIndex, unsigned int endIndex) const;
 
+    // view() returns a StringView of this string's characters, or
+    // of the ones from startIndex up to (but not including)
+    // endIndex, without copying them.  Like substring(), it throws
+    // an OutOfBoundsException if the indices are out of bounds.
+    // The view is only valid until this string is modified or
+    // destroyed.
+    StringView view() const noexcept;
+    StringView view(unsigned int startIndex, unsigned int endIndex) const;
+
     // toChars() returns a C-style string that is equivalent
     // (i.e., has the same length and contains the same
     // sequence of characters) as this string.  Note that
@@ -125,8 +200,45 @@ public:
     const char* toChars() const noexcept;
 
 private:
+    // Strings of up to INLINE_CAPACITY characters are stored in
+    // inline_characters, within the String object itself, so that
+    // they never allocate; longer ones are stored in a dynamically-
+    // allocated SharedBuffer with room for max_chars characters,
+    // which is reference-counted so that copies can share it (and
+    // which comes from a StringArena when one is in use).
+    // Either way, characters points to the first character and is
+    // always null-terminated.
+    //
+    // Once non-const at() has handed out a reference into a buffer,
+    // shareable is false, so that later copies don't share a buffer
+    // that might still be written through that reference.
+    static constexpr unsigned int INLINE_CAPACITY = 15;
+
+    struct SharedBuffer;
+
     unsigned int num_chars;
+    unsigned int max_chars;
     char * characters;
+    char inline_characters[INLINE_CAPACITY + 1];
+    bool shareable;
+
+    // The result of hash(), which is only meaningful when hash_valid
+    // is true; anything that modifies the characters resets it.
+    mutable unsigned int hash_value;
+    mutable bool hash_valid;
+
+    bool isInline() const noexcept;
+    bool isShared() const noexcept;
+    static SharedBuffer * bufferOf(char* chars) noexcept;
+    static unsigned int blocksFor(unsigned int capacity) noexcept;
+    static char * allocate(unsigned int capacity);
+    void release() noexcept;
+    void adopt(char* new_characters, unsigned int capacity) noexcept;
+    void makeUnique();
+    void becomeEmpty() noexcept;
+    char * prepare(unsigned int size);
+    void reallocate(unsigned int newCapacity);
+    void assign(const char* chars, unsigned int size);
 };
 
 
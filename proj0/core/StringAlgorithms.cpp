@@ -0,0 +1,361 @@
+// StringAlgorithms.cpp
+//
+// ICS 46 Spring 2020
+// Project #0: Getting to Know the ICS 46 VM
+
+#include "StringAlgorithms.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+
+
+namespace
+{
+    // Needles longer than this are searched for with Horspool's algorithm,
+    // whose skip table only pays for itself once the needle is long enough
+    // to allow long skips.
+    constexpr unsigned int SHORT_NEEDLE_LENGTH = 16;
+
+
+    using Word = unsigned long long;
+
+
+    Word loadWord(const char* chars) noexcept
+    {
+#if defined(__GNUC__)
+        Word word;
+        __builtin_memcpy(&word, chars, sizeof(Word));
+        return word;
+#else
+        Word word = 0;
+
+        for (unsigned int i = 0; i < sizeof(Word); ++i)
+        {
+            word |= static_cast<Word>(static_cast<unsigned char>(chars[i])) << (8 * i);
+        }
+
+        return word;
+#endif
+    }
+
+
+    // firstDifference() returns the first index at which the two arrays
+    // differ, or length if they don't.
+    unsigned int firstDifference(const char* a, const char* b, unsigned int length) noexcept
+    {
+        unsigned int i = 0;
+
+#if defined(__SSE2__)
+        for (; i + 16 <= length; i += 16)
+        {
+            __m128i aBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+            __m128i bBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+            unsigned int equalMask = _mm_movemask_epi8(_mm_cmpeq_epi8(aBlock, bBlock));
+
+            if (equalMask != 0xFFFF)
+            {
+                return i + __builtin_ctz(~equalMask);
+            }
+        }
+#endif
+
+        for (; i + sizeof(Word) <= length; i += sizeof(Word))
+        {
+            if (loadWord(a + i) != loadWord(b + i))
+            {
+                break;
+            }
+        }
+
+        for (; i < length; ++i)
+        {
+            if (a[i] != b[i])
+            {
+                return i;
+            }
+        }
+
+        return length;
+    }
+
+
+    bool sameChars(const char* a, const char* b, unsigned int count) noexcept
+    {
+        return firstDifference(a, b, count) == count;
+    }
+
+
+    int findChar(
+        const char* haystack, unsigned int haystackLength,
+        char c, unsigned int startIndex) noexcept
+    {
+        unsigned int i = startIndex;
+
+#if defined(__SSE2__)
+        const __m128i target = _mm_set1_epi8(c);
+
+        for (; i + 16 <= haystackLength; i += 16)
+        {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + i));
+            int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(block, target));
+
+            if (mask != 0)
+            {
+                return static_cast<int>(i + __builtin_ctz(mask));
+            }
+        }
+#endif
+
+        for (; i < haystackLength; ++i)
+        {
+            if (haystack[i] == c)
+            {
+                return static_cast<int>(i);
+            }
+        }
+
+        return -1;
+    }
+
+
+    // Only positions whose first and last characters both match the
+    // needle's are compared in full.  The needle has at least two
+    // characters.
+    int findShort(
+        const char* haystack, unsigned int haystackLength,
+        const char* needle, unsigned int needleLength,
+        unsigned int startIndex) noexcept
+    {
+        const char first = needle[0];
+        const char last = needle[needleLength - 1];
+        const unsigned int lastStart = haystackLength - needleLength;
+
+        unsigned int i = startIndex;
+
+#if defined(__SSE2__)
+        const __m128i firstTarget = _mm_set1_epi8(first);
+        const __m128i lastTarget = _mm_set1_epi8(last);
+
+        // Each pass checks the 16 windows starting at i..i+15, all of
+        // which have to fit within the haystack.
+        for (; i + 15 <= lastStart; i += 16)
+        {
+            __m128i firstBlock = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(haystack + i));
+            __m128i lastBlock = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(haystack + i + needleLength - 1));
+
+            unsigned int mask = _mm_movemask_epi8(_mm_and_si128(
+                _mm_cmpeq_epi8(firstBlock, firstTarget),
+                _mm_cmpeq_epi8(lastBlock, lastTarget)));
+
+            while (mask != 0)
+            {
+                unsigned int offset = __builtin_ctz(mask);
+
+                if (sameChars(haystack + i + offset + 1, needle + 1, needleLength - 2))
+                {
+                    return static_cast<int>(i + offset);
+                }
+
+                mask &= mask - 1;
+            }
+        }
+#endif
+
+        for (; i <= lastStart; ++i)
+        {
+            if (haystack[i] == first && haystack[i + needleLength - 1] == last
+                && sameChars(haystack + i + 1, needle + 1, needleLength - 2))
+            {
+                return static_cast<int>(i);
+            }
+        }
+
+        return -1;
+    }
+
+
+    // Boyer-Moore-Horspool: after each attempt, the window moves far enough
+    // that the character under its last position lines up with the nearest
+    // occurrence of that character in the needle (or past it entirely).
+    int findLong(
+        const char* haystack, unsigned int haystackLength,
+        const char* needle, unsigned int needleLength,
+        unsigned int startIndex) noexcept
+    {
+        unsigned int shift[256];
+
+        for (unsigned int c = 0; c < 256; ++c)
+        {
+            shift[c] = needleLength;
+        }
+
+        for (unsigned int j = 0; j + 1 < needleLength; ++j)
+        {
+            shift[static_cast<unsigned char>(needle[j])] = needleLength - 1 - j;
+        }
+
+        const char last = needle[needleLength - 1];
+        const unsigned int lastStart = haystackLength - needleLength;
+
+        for (unsigned int i = startIndex; i <= lastStart; )
+        {
+            char c = haystack[i + needleLength - 1];
+
+            if (c == last && sameChars(haystack + i, needle, needleLength - 1))
+            {
+                return static_cast<int>(i);
+            }
+
+            i += shift[static_cast<unsigned char>(c)];
+        }
+
+        return -1;
+    }
+}
+
+
+
+bool equalChars(const char* a, const char* b, unsigned int length) noexcept
+{
+    return sameChars(a, b, length);
+}
+
+
+int compareChars(
+    const char* a, unsigned int aLength,
+    const char* b, unsigned int bLength) noexcept
+{
+    unsigned int commonLength = aLength < bLength ? aLength : bLength;
+    unsigned int index = firstDifference(a, b, commonLength);
+
+    if (index < commonLength)
+    {
+        return a[index] < b[index] ? -1 : 1;
+    }
+    else if (aLength == bLength)
+    {
+        return 0;
+    }
+    else
+    {
+        return aLength < bLength ? -1 : 1;
+    }
+}
+
+
+// Each word is mixed into the hash with a multiply and an xor-shift, the
+// same steps used by the splitmix64 generator, which spread every input
+// bit across the whole word.
+
+unsigned int hashChars(const char* chars, unsigned int length) noexcept
+{
+    Word hash = length * 0x9E3779B97F4A7C15ULL;
+    unsigned int i = 0;
+
+    for (; i + sizeof(Word) <= length; i += sizeof(Word))
+    {
+        hash = (hash ^ loadWord(chars + i)) * 0xBF58476D1CE4E5B9ULL;
+        hash ^= hash >> 31;
+    }
+
+    if (i < length)
+    {
+        Word tail = 0;
+
+        for (unsigned int shift = 0; i < length; ++i, shift += 8)
+        {
+            tail |= static_cast<Word>(static_cast<unsigned char>(chars[i])) << shift;
+        }
+
+        hash = (hash ^ tail) * 0xBF58476D1CE4E5B9ULL;
+        hash ^= hash >> 31;
+    }
+
+    hash *= 0x94D049BB133111EBULL;
+    hash ^= hash >> 32;
+
+    return static_cast<unsigned int>(hash);
+}
+
+
+int findChars(
+    const char* haystack, unsigned int haystackLength,
+    const char* needle, unsigned int needleLength,
+    unsigned int startIndex) noexcept
+{
+    if (startIndex > haystackLength || needleLength > haystackLength - startIndex)
+    {
+        return -1;
+    }
+    else if (needleLength == 0)
+    {
+        return static_cast<int>(startIndex);
+    }
+    else if (needleLength == 1)
+    {
+        return findChar(haystack, haystackLength, needle[0], startIndex);
+    }
+    else if (needleLength <= SHORT_NEEDLE_LENGTH)
+    {
+        return findShort(haystack, haystackLength, needle, needleLength, startIndex);
+    }
+    else
+    {
+        return findLong(haystack, haystackLength, needle, needleLength, startIndex);
+    }
+}
+
+
+// This is Horspool's algorithm run from right to left, so the window is
+// shifted according to the character under its first position.
+
+int rfindChars(
+    const char* haystack, unsigned int haystackLength,
+    const char* needle, unsigned int needleLength) noexcept
+{
+    if (needleLength > haystackLength)
+    {
+        return -1;
+    }
+    else if (needleLength == 0)
+    {
+        return static_cast<int>(haystackLength);
+    }
+
+    unsigned int shift[256];
+
+    for (unsigned int c = 0; c < 256; ++c)
+    {
+        shift[c] = needleLength;
+    }
+
+    for (unsigned int j = needleLength - 1; j > 0; --j)
+    {
+        shift[static_cast<unsigned char>(needle[j])] = j;
+    }
+
+    const char first = needle[0];
+
+    for (unsigned int i = haystackLength - needleLength; ; )
+    {
+        char c = haystack[i];
+
+        if (c == first && sameChars(haystack + i + 1, needle + 1, needleLength - 1))
+        {
+            return static_cast<int>(i);
+        }
+
+        unsigned int distance = shift[static_cast<unsigned char>(c)];
+
+        if (distance > i)
+        {
+            return -1;
+        }
+
+        i -= distance;
+    }
+}
@@ -0,0 +1,65 @@
+// StringAlgorithms.hpp
+//
+// ICS 46 Spring 2020
+// Project #0: Getting to Know the ICS 46 VM
+//
+// Low-level algorithms that operate on arrays of characters, given a
+// pointer to the first character and a length.  String is built on top
+// of these, but they don't depend on String, so they can be used on any
+// sequence of characters (none of them require a null terminator).
+//
+// Like String.cpp, the implementations don't use the C or C++ Standard
+// Library.
+
+#ifndef STRINGALGORITHMS_HPP
+#define STRINGALGORITHMS_HPP
+
+
+
+// equalChars() returns true if the two arrays have the same characters
+// in their first length positions, false otherwise.
+//
+// compareChars() compares two character sequences lexicographically,
+// returning zero if they're equal, a negative value if the first is
+// less than the second, or a positive value if it's greater.
+//
+// Both compare 16 characters at a time where SSE2 is available, and a
+// machine word at a time otherwise, only looking at individual characters
+// once a block containing a difference has been found.
+bool equalChars(const char* a, const char* b, unsigned int length) noexcept;
+
+int compareChars(
+    const char* a, unsigned int aLength,
+    const char* b, unsigned int bLength) noexcept;
+
+
+// hashChars() returns a hash of the given characters, consuming them
+// a machine word at a time.
+unsigned int hashChars(const char* chars, unsigned int length) noexcept;
+
+
+// findChars() returns the index of the first occurrence of the needle
+// within the haystack that begins at or after startIndex, or -1 if
+// there isn't one.  An empty needle is found at startIndex.
+//
+// Single-character needles are found with a byte scan, short needles
+// with a filter that checks their first and last characters at many
+// positions at once, and long needles with the Boyer-Moore-Horspool
+// algorithm, which usually skips over most of the haystack.  Where
+// SSE2 is available, the first two are done 16 positions at a time.
+int findChars(
+    const char* haystack, unsigned int haystackLength,
+    const char* needle, unsigned int needleLength,
+    unsigned int startIndex = 0) noexcept;
+
+
+// rfindChars() returns the index of the last occurrence of the needle
+// within the haystack, or -1 if there isn't one.  An empty needle is
+// found at haystackLength.
+int rfindChars(
+    const char* haystack, unsigned int haystackLength,
+    const char* needle, unsigned int needleLength) noexcept;
+
+
+
+#endif
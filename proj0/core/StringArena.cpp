@@ -0,0 +1,136 @@
+// StringArena.cpp
+//
+// ICS 46 Spring 2020
+// Project #0: Getting to Know the ICS 46 VM
+//
+// Like String.cpp, this doesn't use the C or C++ Standard Library.
+
+#include "StringArena.hpp"
+
+
+namespace
+{
+    thread_local StringArena * currentArena = nullptr;
+}
+
+
+//Slabs are kept in a list, in the order they were obtained, so that a
+//reset arena can reuse them from the beginning.
+struct StringArena::Slab {
+    Slab * next;
+    alignas(16) unsigned char bytes[SLAB_SIZE];
+};
+
+//A released block holds the link to the next free block of its size.
+struct StringArena::FreeBlock {
+    FreeBlock * next;
+};
+
+
+StringArena::Scope::Scope(StringArena &arena) noexcept
+    : previous{currentArena}
+{
+    currentArena = &arena;
+}
+
+StringArena::Scope::~Scope() noexcept {
+    currentArena = previous;
+}
+
+
+StringArena::StringArena() noexcept
+    : first_slab{nullptr}, current_slab{nullptr}, slab_used{0},
+      allocation_count{0}, slab_count{0}
+{
+    for (unsigned int i = 0; i < SIZE_CLASSES; ++i) {
+        free_blocks[i] = nullptr;
+    }
+}
+
+StringArena::~StringArena() noexcept {
+    while (first_slab != nullptr) {
+        Slab * next = first_slab->next;
+        delete first_slab;
+        first_slab = next;
+    }
+}
+
+StringArena *StringArena::current() noexcept {
+    return currentArena;
+}
+
+void *StringArena::allocate(unsigned int bytes) {
+    unsigned int size_class = sizeClassOf(bytes);
+    allocation_count++;
+
+    if (free_blocks[size_class] != nullptr) {
+        FreeBlock * block = free_blocks[size_class];
+        free_blocks[size_class] = block->next;
+        return block;
+    }
+
+    unsigned int size = SMALLEST_ALLOCATION << size_class;
+    if (current_slab == nullptr || slab_used + size > SLAB_SIZE) {
+        nextSlab();
+    }
+
+    void * block = current_slab->bytes + slab_used;
+    slab_used += size;
+    return block;
+}
+
+void StringArena::deallocate(void *block, unsigned int bytes) noexcept {
+    unsigned int size_class = sizeClassOf(bytes);
+
+    FreeBlock * freed = static_cast<FreeBlock*>(block);
+    freed->next = free_blocks[size_class];
+    free_blocks[size_class] = freed;
+}
+
+void StringArena::reset() noexcept {
+    current_slab = nullptr;
+    slab_used = 0;
+
+    for (unsigned int i = 0; i < SIZE_CLASSES; ++i) {
+        free_blocks[i] = nullptr;
+    }
+}
+
+unsigned int StringArena::allocationCount() const noexcept {
+    return allocation_count;
+}
+
+unsigned int StringArena::slabCount() const noexcept {
+    return slab_count;
+}
+
+unsigned int StringArena::sizeClassOf(unsigned int bytes) noexcept {
+    unsigned int size_class = 0;
+    while ((SMALLEST_ALLOCATION << size_class) < bytes) {
+        size_class++;
+    }
+    return size_class;
+}
+
+//Moves on to the slab after the current one, getting a new one from the
+//global allocator only when there are no more left over from before the
+//last reset().  Whatever was left at the end of the current slab is
+//abandoned until then.
+void StringArena::nextSlab() {
+    Slab * next = current_slab != nullptr ? current_slab->next : first_slab;
+
+    if (next == nullptr) {
+        next = new Slab;
+        next->next = nullptr;
+        slab_count++;
+
+        if (current_slab != nullptr) {
+            current_slab->next = next;
+        } else {
+            first_slab = next;
+        }
+    }
+
+    current_slab = next;
+    slab_used = 0;
+}
@@ -0,0 +1,103 @@
+// StringArena.hpp
+//
+// ICS 46 Spring 2020
+// Project #0: Getting to Know the ICS 46 VM
+//
+// A StringArena hands out the character buffers of Strings from large
+// slabs of memory that it owns, instead of asking the global allocator
+// for each one.  Buffers are grouped into size classes (powers of two),
+// and a buffer that's released goes onto a list for its class so the
+// next String that needs one that size can reuse it.  Resetting the
+// arena makes all of its memory available again at once, without
+// visiting the buffers individually.
+//
+// An arena is used by creating a StringArena::Scope for it; while the
+// scope exists, Strings that allocate on that thread get their buffers
+// from the arena.  Buffers too large for any size class still come from
+// the global allocator.  Every String whose buffer came from an arena
+// (including copies sharing that buffer) must be destroyed before the
+// arena is reset or destroyed, and an arena must only be used by one
+// thread at a time.
+
+#ifndef STRINGARENA_HPP
+#define STRINGARENA_HPP
+
+
+
+class StringArena
+{
+public:
+    // The largest number of bytes that allocate() will hand out.
+    static constexpr unsigned int LARGEST_ALLOCATION = 4096;
+
+    // The number of bytes in each of the slabs that buffers are carved
+    // from.
+    static constexpr unsigned int SLAB_SIZE = 64 * 1024;
+
+    // While a Scope exists, its arena is the one that Strings allocate
+    // from on the thread that created it.  Scopes can be nested; when
+    // one is destroyed, the arena that was in use before it is restored.
+    class Scope
+    {
+    public:
+        explicit Scope(StringArena& arena) noexcept;
+        ~Scope() noexcept;
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        StringArena * previous;
+    };
+
+    // Initializes an arena that owns no memory yet.
+    StringArena() noexcept;
+
+    // Destroys the arena, releasing all of its slabs.
+    ~StringArena() noexcept;
+
+    StringArena(const StringArena&) = delete;
+    StringArena& operator=(const StringArena&) = delete;
+
+    // current() returns the arena that Strings allocate from on this
+    // thread, or nullptr if there isn't one.
+    static StringArena * current() noexcept;
+
+    // allocate() returns a block of at least the given number of bytes,
+    // which must be no more than LARGEST_ALLOCATION, aligned suitably
+    // for any object.  deallocate() makes a block available for reuse;
+    // it must be given the same number of bytes it was allocated with.
+    void * allocate(unsigned int bytes);
+    void deallocate(void* block, unsigned int bytes) noexcept;
+
+    // reset() makes all of the arena's memory available again in O(1)
+    // time, keeping its slabs so they can be reused.
+    void reset() noexcept;
+
+    // allocationCount() returns the number of times allocate() has been
+    // called, and slabCount() the number of slabs that the arena has
+    // needed to get from the global allocator to satisfy them.
+    unsigned int allocationCount() const noexcept;
+    unsigned int slabCount() const noexcept;
+
+private:
+    static constexpr unsigned int SMALLEST_ALLOCATION = 32;
+    static constexpr unsigned int SIZE_CLASSES = 8;
+
+    struct Slab;
+    struct FreeBlock;
+
+    Slab * first_slab;
+    Slab * current_slab;
+    unsigned int slab_used;
+    FreeBlock * free_blocks[SIZE_CLASSES];
+    unsigned int allocation_count;
+    unsigned int slab_count;
+
+    static unsigned int sizeClassOf(unsigned int bytes) noexcept;
+    void nextSlab();
+};
+
+
+
+#endif
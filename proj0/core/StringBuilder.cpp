@@ -0,0 +1,270 @@
+// StringBuilder.cpp
+//
+// ICS 46 Spring 2020
+// Project #0: Getting to Know the ICS 46 VM
+//
+// Like String.cpp, this doesn't use the C or C++ Standard Library.
+
+#include "StringBuilder.hpp"
+#include "OutOfBoundsException.hpp"
+
+
+namespace
+{
+    // Pieces shorter than this are added to the last leaf (when it's also
+    // shorter than this) instead of getting a leaf of their own.
+    constexpr unsigned int SHORT_PIECE_LENGTH = 64;
+}
+
+
+//Leaves have a chunk and no children; every other node has two children
+//and an empty chunk.  A leaf's height is 0.
+struct StringBuilder::Node {
+    String chunk;
+    Node * left;
+    Node * right;
+    unsigned int length;
+    int height;
+};
+
+
+StringBuilder::StringBuilder() noexcept
+    : root{nullptr}
+{
+}
+
+StringBuilder::StringBuilder(const StringBuilder &b)
+    : root{copy(b.root)}
+{
+}
+
+StringBuilder::StringBuilder(StringBuilder &&b) noexcept
+    : root{b.root}
+{
+    b.root = nullptr;
+}
+
+StringBuilder::~StringBuilder() noexcept {
+    destroy(root);
+}
+
+StringBuilder &StringBuilder::operator=(const StringBuilder &b) {
+    if (this != &b) {
+        Node * new_root = copy(b.root);
+        destroy(root);
+        root = new_root;
+    }
+    return *this;
+}
+
+StringBuilder &StringBuilder::operator=(StringBuilder &&b) noexcept {
+    Node * temp = root;
+    root = b.root;
+    b.root = temp;
+    return *this;
+}
+
+void StringBuilder::append(const String &s) {
+    if (s.isEmpty()) {
+        return;
+    }
+
+    if (root != nullptr && s.length() < SHORT_PIECE_LENGTH) {
+        //Find the last leaf, which is at the end of the right spine
+        Node * last = root;
+        while (last->right != nullptr) {
+            last = last->right;
+        }
+
+        if (last->chunk.length() < SHORT_PIECE_LENGTH) {
+            last->chunk.append(s);
+
+            for (Node * node = root; node != nullptr; node = node->right) {
+                node->length += s.length();
+            }
+            return;
+        }
+    }
+
+    Node * leaf = makeLeaf(s);
+    Node * spare = nullptr;
+
+    if (root != nullptr) {
+        try {
+            spare = new Node{String{}, nullptr, nullptr, 0, 0};
+        } catch (...) {
+            delete leaf;
+            throw;
+        }
+    }
+
+    root = join(root, leaf, spare);
+}
+
+void StringBuilder::append(StringView v) {
+    append(String{v});
+}
+
+void StringBuilder::append(StringBuilder &&b) {
+    if (this == &b || b.root == nullptr) {
+        return;
+    }
+
+    Node * spare = root != nullptr ? new Node{String{}, nullptr, nullptr, 0, 0} : nullptr;
+    root = join(root, b.root, spare);
+    b.root = nullptr;
+}
+
+char StringBuilder::at(unsigned int index) const {
+    if (index >= length()) {
+        throw OutOfBoundsException{};
+    }
+
+    const Node * node = root;
+    while (node->left != nullptr) {
+        if (index < node->left->length) {
+            node = node->left;
+        } else {
+            index -= node->left->length;
+            node = node->right;
+        }
+    }
+
+    return node->chunk.at(index);
+}
+
+void StringBuilder::clear() noexcept {
+    destroy(root);
+    root = nullptr;
+}
+
+bool StringBuilder::isEmpty() const noexcept {
+    return root == nullptr;
+}
+
+unsigned int StringBuilder::length() const noexcept {
+    return root != nullptr ? root->length : 0;
+}
+
+String StringBuilder::toString() const {
+    String result;
+    result.reserve(length());
+    appendLeaves(root, result);
+    return result;
+}
+
+StringBuilder::Node * StringBuilder::makeLeaf(const String &s) {
+    return new Node{s, nullptr, nullptr, s.length(), 0};
+}
+
+StringBuilder::Node * StringBuilder::copy(const Node *node) {
+    if (node == nullptr) {
+        return nullptr;
+    }
+
+    Node * left = copy(node->left);
+    Node * right = nullptr;
+
+    try {
+        right = copy(node->right);
+        return new Node{node->chunk, left, right, node->length, node->height};
+    } catch (...) {
+        destroy(left);
+        destroy(right);
+        throw;
+    }
+}
+
+void StringBuilder::destroy(Node *node) noexcept {
+    if (node != nullptr) {
+        destroy(node->left);
+        destroy(node->right);
+        delete node;
+    }
+}
+
+//Joins two trees, every leaf of left coming before every leaf of right,
+//descending the taller one until the heights are close enough to hang
+//them both from one new node (spare, which is allocated by the caller
+//so that joining can't fail partway through), then rebalancing on the
+//way back up.  This takes time proportional to the difference in their
+//heights.  spare is only null when left is.
+StringBuilder::Node * StringBuilder::join(Node *left, Node *right, Node *spare) noexcept {
+    if (left == nullptr) {
+        return right;
+    }
+
+    if (left->height > right->height + 1) {
+        left->right = join(left->right, right, spare);
+        return rebalance(left);
+    } else if (right->height > left->height + 1) {
+        right->left = join(left, right->left, spare);
+        return rebalance(right);
+    } else {
+        spare->left = left;
+        spare->right = right;
+        update(spare);
+        return spare;
+    }
+}
+
+StringBuilder::Node * StringBuilder::rebalance(Node *node) noexcept {
+    update(node);
+
+    int balance = node->left->height - node->right->height;
+
+    if (balance > 1) {
+        if (node->left->left->height < node->left->right->height) {
+            node->left = rotateLeft(node->left);
+        }
+        return rotateRight(node);
+    } else if (balance < -1) {
+        if (node->right->right->height < node->right->left->height) {
+            node->right = rotateRight(node->right);
+        }
+        return rotateLeft(node);
+    } else {
+        return node;
+    }
+}
+
+StringBuilder::Node * StringBuilder::rotateLeft(Node *node) noexcept {
+    Node * newTop = node->right;
+    node->right = newTop->left;
+    newTop->left = node;
+
+    update(node);
+    update(newTop);
+    return newTop;
+}
+
+StringBuilder::Node * StringBuilder::rotateRight(Node *node) noexcept {
+    Node * newTop = node->left;
+    node->left = newTop->right;
+    newTop->right = node;
+
+    update(node);
+    update(newTop);
+    return newTop;
+}
+
+void StringBuilder::update(Node *node) noexcept {
+    node->length = node->left->length + node->right->length;
+
+    if (node->left->height > node->right->height) {
+        node->height = node->left->height + 1;
+    } else {
+        node->height = node->right->height + 1;
+    }
+}
+
+void StringBuilder::appendLeaves(const Node *node, String &result) {
+    if (node == nullptr) {
+        return;
+    } else if (node->left == nullptr) {
+        result.append(node->chunk);
+    } else {
+        appendLeaves(node->left, result);
+        appendLeaves(node->right, result);
+    }
+}
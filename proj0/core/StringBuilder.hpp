@@ -0,0 +1,105 @@
+// StringBuilder.hpp
+//
+// ICS 46 Spring 2020
+// Project #0: Getting to Know the ICS 46 VM
+//
+// A StringBuilder collects a sequence of strings that will eventually
+// be joined into one, without repeatedly copying the characters that
+// have been collected so far (which is what happens when a long String
+// is built with a chain of concatenate() calls).  The characters are
+// copied once, when toString() is called.
+//
+// Internally, a StringBuilder is a rope: a binary tree whose leaves are
+// the appended strings, in order, and whose other nodes each know how
+// many characters are below them.  The tree is kept balanced the same
+// way an AVL tree is, so it's never more than logarithmically deep,
+// which keeps at() fast and lets two builders be joined in logarithmic
+// time.
+
+#ifndef STRINGBUILDER_HPP
+#define STRINGBUILDER_HPP
+
+#include "String.hpp"
+#include "StringView.hpp"
+
+
+
+class StringBuilder
+{
+public:
+    // Initializes a builder that contains no characters.
+    StringBuilder() noexcept;
+
+    // Initializes a builder as a copy of an existing one.  The tree is
+    // copied, but the strings in its leaves are shared with the original
+    // (see String's copy constructor), so the characters aren't.
+    StringBuilder(const StringBuilder& b);
+
+    // Initializes a builder from an expiring one, which is left empty.
+    StringBuilder(StringBuilder&& b) noexcept;
+
+    // Destroys the builder, releasing all of its memory.
+    ~StringBuilder() noexcept;
+
+    // Replaces the contents of this builder with a copy of another's.
+    StringBuilder& operator=(const StringBuilder& b);
+
+    // Replaces the contents of this builder with an expiring one's,
+    // which is left empty.
+    StringBuilder& operator=(StringBuilder&& b) noexcept;
+
+
+    // append() adds characters to the end of the builder in O(log n)
+    // time, where n is the number of strings appended so far.  Strings
+    // are kept as they are, without copying their characters; views are
+    // copied, since their characters belong to something else.  Short
+    // pieces are added to the end of the last leaf when it's also short,
+    // so that building from many small pieces doesn't create a leaf for
+    // each of them.
+    void append(const String& s);
+    void append(StringView v);
+
+    // append() can also move all of the contents of another builder to
+    // the end of this one, leaving the other builder empty.  This takes
+    // O(log n) time, regardless of how many characters are involved.
+    void append(StringBuilder&& b);
+
+    // at() returns one of the characters in the builder, given a
+    // zero-based index, in O(log n) time.  If the given index is not the
+    // index of a character within the builder, this member function
+    // throws an OutOfBoundsException.
+    char at(unsigned int index) const;
+
+    // clear() makes this builder be empty.
+    void clear() noexcept;
+
+    // isEmpty() returns true if this builder contains no characters, or
+    // false otherwise.
+    bool isEmpty() const noexcept;
+
+    // length() returns the number of characters in this builder.
+    unsigned int length() const noexcept;
+
+    // toString() returns a String containing all of the characters in
+    // the builder, in order.  This is the only time they're copied.
+    String toString() const;
+
+private:
+    struct Node;
+
+    Node * root;
+
+    static Node * makeLeaf(const String& s);
+    static Node * copy(const Node* node);
+    static void destroy(Node* node) noexcept;
+    static Node * join(Node* left, Node* right, Node* spare) noexcept;
+    static Node * rebalance(Node* node) noexcept;
+    static Node * rotateLeft(Node* node) noexcept;
+    static Node * rotateRight(Node* node) noexcept;
+    static void update(Node* node) noexcept;
+    static void appendLeaves(const Node* node, String& result);
+};
+
+
+
+#endif
@@ -0,0 +1,81 @@
+// StringView.cpp
+//
+// ICS 46 Spring 2020
+// Project #0: Getting to Know the ICS 46 VM
+//
+// Like String.cpp, this doesn't use the C or C++ Standard Library.
+
+#include "StringView.hpp"
+#include "OutOfBoundsException.hpp"
+#include "String.hpp"
+#include "StringAlgorithms.hpp"
+
+
+StringView::StringView() noexcept
+    : chars{""}, num_chars{0}
+{
+}
+
+StringView::StringView(const char *chars, unsigned int length) noexcept
+    : chars{chars}, num_chars{length}
+{
+}
+
+StringView::StringView(const char *chars) noexcept
+    : chars{chars}, num_chars{0}
+{
+    while (chars[num_chars] != '\0') {
+        num_chars++;
+    }
+}
+
+StringView::StringView(const String &s) noexcept
+    : chars{s.toChars()}, num_chars{s.length()}
+{
+}
+
+char StringView::at(unsigned int index) const {
+    if (index >= num_chars) {
+        throw OutOfBoundsException{};
+    }
+    return chars[index];
+}
+
+int StringView::compareTo(StringView v) const noexcept {
+    return compareChars(chars, num_chars, v.chars, v.num_chars);
+}
+
+bool StringView::contains(StringView substring) const noexcept {
+    return find(substring) >= 0;
+}
+
+const char *StringView::data() const noexcept {
+    return chars;
+}
+
+bool StringView::equals(StringView v) const noexcept {
+    return num_chars == v.num_chars && equalChars(chars, v.chars, num_chars);
+}
+
+int StringView::find(StringView substring) const noexcept {
+    return findChars(chars, num_chars, substring.chars, substring.num_chars);
+}
+
+int StringView::rfind(StringView substring) const noexcept {
+    return rfindChars(chars, num_chars, substring.chars, substring.num_chars);
+}
+
+bool StringView::isEmpty() const noexcept {
+    return num_chars == 0;
+}
+
+unsigned int StringView::length() const noexcept {
+    return num_chars;
+}
+
+StringView StringView::substring(unsigned int startIndex, unsigned int endIndex) const {
+    if (endIndex > num_chars || startIndex > endIndex) {
+        throw OutOfBoundsException{};
+    }
+    return StringView{chars + startIndex, endIndex - startIndex};
+}
@@ -0,0 +1,94 @@
+// StringView.hpp
+//
+// ICS 46 Spring 2020
+// Project #0: Getting to Know the ICS 46 VM
+//
+// A StringView refers to a sequence of characters that is owned by
+// something else -- usually a String, or part of one -- without copying
+// them.  Creating, copying and slicing a StringView never allocates
+// memory, which makes it a good way to take apart a large String (e.g.,
+// to split it into tokens) without building a new String for every
+// piece.
+//
+// Because a StringView doesn't own its characters, it's only valid as
+// long as they are; a view of a String must not be used after that
+// String has been modified or destroyed.  Unlike a String, the
+// characters of a StringView are not null-terminated.
+
+#ifndef STRINGVIEW_HPP
+#define STRINGVIEW_HPP
+
+
+
+class String;
+
+
+class StringView
+{
+public:
+    // Initializes a view of no characters.
+    StringView() noexcept;
+
+    // Initializes a view of the given number of characters, beginning
+    // with the one that chars points to.
+    StringView(const char* chars, unsigned int length) noexcept;
+
+    // Initializes a view of a C-style string, which is assumed to be
+    // null-terminated.
+    explicit StringView(const char* chars) noexcept;
+
+    // Initializes a view of all of the characters in a String.
+    StringView(const String& s) noexcept;
+
+
+    // at() returns one of the characters in the view, given a zero-based
+    // index.  If the index is not the index of a character within the
+    // view, this member function throws an OutOfBoundsException.
+    char at(unsigned int index) const;
+
+    // compareTo() compares the characters in this view to the characters
+    // in another lexicographically, returning zero if they're equal, a
+    // negative value if this view is "less than" the other one, or a
+    // positive value if it's "greater than" the other one.
+    int compareTo(StringView v) const noexcept;
+
+    // contains() returns true if the given view's characters appear
+    // somewhere within this one, or false otherwise.
+    bool contains(StringView substring) const noexcept;
+
+    // data() returns a pointer to the first character in the view.  Note
+    // that the characters are not necessarily followed by a null
+    // terminator.
+    const char* data() const noexcept;
+
+    // equals() returns true if the two views have the same length and
+    // contain the same sequence of characters.
+    bool equals(StringView v) const noexcept;
+
+    // find() returns the index where the given substring is found within
+    // this view, or -1 if it's not found.  rfind() does the same, except
+    // that it finds the last occurrence instead of the first.
+    int find(StringView substring) const noexcept;
+    int rfind(StringView substring) const noexcept;
+
+    // isEmpty() returns true if this view contains no characters, or
+    // false otherwise.
+    bool isEmpty() const noexcept;
+
+    // length() returns the number of characters in this view.
+    unsigned int length() const noexcept;
+
+    // substring() returns a view of the characters in this one beginning
+    // at startIndex and ending at (but not including) endIndex.  No
+    // characters are copied.  If the indices are out of bounds, this
+    // member function throws an OutOfBoundsException.
+    StringView substring(unsigned int startIndex, unsigned int endIndex) const;
+
+private:
+    const char * chars;
+    unsigned int num_chars;
+};
+
+
+
+#endif
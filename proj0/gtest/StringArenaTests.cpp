@@ -0,0 +1,142 @@
+// StringArenaTests.cpp
+//
+// ICS 46 Spring 2020
+// Project #0: Getting to Know the ICS 46 VM
+//
+// Unit tests for StringArena, and for Strings that allocate from one.
+
+#include <gtest/gtest.h>
+#include "String.hpp"
+#include "StringArena.hpp"
+
+
+TEST(StringArenaTests, noArenaIsCurrentOutsideOfAScope)
+{
+    EXPECT_EQ(nullptr, StringArena::current());
+}
+
+
+TEST(StringArenaTests, scopesMakeTheirArenaCurrentUntilDestroyed)
+{
+    StringArena outer;
+    StringArena inner;
+
+    {
+        StringArena::Scope outerScope{outer};
+        EXPECT_EQ(&outer, StringArena::current());
+
+        {
+            StringArena::Scope innerScope{inner};
+            EXPECT_EQ(&inner, StringArena::current());
+        }
+
+        EXPECT_EQ(&outer, StringArena::current());
+    }
+
+    EXPECT_EQ(nullptr, StringArena::current());
+}
+
+
+TEST(StringArenaTests, longStringsAllocateFromTheCurrentArena)
+{
+    StringArena arena;
+    StringArena::Scope scope{arena};
+
+    String s{"Boo is the very best dog in the world"};
+    String t = s.concatenate(s);
+
+    EXPECT_STREQ("Boo is the very best dog in the world", s.toChars());
+    EXPECT_EQ(74, t.length());
+    EXPECT_EQ(2, arena.allocationCount());
+    EXPECT_EQ(1, arena.slabCount());
+}
+
+
+TEST(StringArenaTests, shortStringsDoNotAllocateFromTheArena)
+{
+    StringArena arena;
+    StringArena::Scope scope{arena};
+
+    String s{"Boo"};
+    s.append(String{"!"});
+
+    EXPECT_STREQ("Boo!", s.toChars());
+    EXPECT_EQ(0, arena.allocationCount());
+}
+
+
+TEST(StringArenaTests, releasedBuffersAreReused)
+{
+    StringArena arena;
+    StringArena::Scope scope{arena};
+
+    const char* first;
+    {
+        String s{"Boo is the very best dog in the world"};
+        first = s.toChars();
+    }
+
+    String t{"Boo is happy today, and so is everyone"};
+
+    EXPECT_EQ(first, t.toChars());
+    EXPECT_EQ(2, arena.allocationCount());
+}
+
+
+TEST(StringArenaTests, manyStringsShareFewSlabs)
+{
+    StringArena arena;
+    StringArena::Scope scope{arena};
+
+    String s{"Boo is the very best dog in the world"};
+
+    for (unsigned int i = 0; i < 100000; ++i)
+    {
+        String copy = s.concatenate(s);
+        EXPECT_EQ(74, copy.length());
+    }
+
+    EXPECT_EQ(100001, arena.allocationCount());
+    EXPECT_EQ(1, arena.slabCount());
+}
+
+
+TEST(StringArenaTests, resetArenasReuseTheirSlabs)
+{
+    StringArena arena;
+    StringArena::Scope scope{arena};
+
+    for (unsigned int round = 0; round < 3; ++round)
+    {
+        {
+            String s{"Boo is the very best dog in the world"};
+
+            for (unsigned int i = 0; i < 12; ++i)
+            {
+                s.append(s);
+            }
+
+            EXPECT_EQ(37 * 4096, s.length());
+        }
+
+        arena.reset();
+    }
+
+    EXPECT_EQ(1, arena.slabCount());
+}
+
+
+TEST(StringArenaTests, stringsLargerThanAnySizeClassUseTheGlobalAllocator)
+{
+    StringArena arena;
+    StringArena::Scope scope{arena};
+
+    String s{"Boo is the very best dog in the world"};
+    unsigned int before = arena.allocationCount();
+
+    s.reserve(StringArena::LARGEST_ALLOCATION * 2);
+    s.append(String{"!"});
+
+    EXPECT_EQ(before, arena.allocationCount());
+    EXPECT_STREQ("Boo is the very best dog in the world!", s.toChars());
+}
@@ -0,0 +1,131 @@
+// StringBuilderTests.cpp
+//
+// ICS 46 Spring 2020
+// Project #0: Getting to Know the ICS 46 VM
+//
+// Unit tests for StringBuilder.
+
+#include <gtest/gtest.h>
+#include "OutOfBoundsException.hpp"
+#include "String.hpp"
+#include "StringBuilder.hpp"
+
+
+TEST(StringBuilderTests, emptyWhenDefaultConstructed)
+{
+    StringBuilder b;
+
+    EXPECT_TRUE(b.isEmpty());
+    EXPECT_EQ(0, b.length());
+    EXPECT_STREQ("", b.toString().toChars());
+}
+
+
+TEST(StringBuilderTests, toStringJoinsAppendedStringsInOrder)
+{
+    StringBuilder b;
+    b.append(String{"Boo "});
+    b.append(String{"is "});
+    b.append(String{"the very best"});
+
+    EXPECT_EQ(20, b.length());
+    EXPECT_STREQ("Boo is the very best", b.toString().toChars());
+}
+
+
+TEST(StringBuilderTests, canAppendViews)
+{
+    String s{"Every day is Boo's day"};
+
+    StringBuilder b;
+    b.append(s.view(13, 18));
+    b.append(s.view(18, 22));
+
+    EXPECT_STREQ("Boo's day", b.toString().toChars());
+}
+
+
+TEST(StringBuilderTests, canObtainCharactersFromLargeBuilders)
+{
+    String piece{"0123456789abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz"};
+
+    StringBuilder b;
+    for (unsigned int i = 0; i < 10000; ++i)
+    {
+        b.append(piece);
+    }
+
+    EXPECT_EQ(720000, b.length());
+
+    for (unsigned int i = 0; i < b.length(); i += 997)
+    {
+        EXPECT_EQ(piece.at(i % 72), b.at(i));
+    }
+}
+
+
+TEST(StringBuilderTests, obtainingCharactersOutOfBoundsFails)
+{
+    StringBuilder b;
+    b.append(String{"Boo!"});
+
+    EXPECT_THROW({ b.at(4); }, OutOfBoundsException);
+}
+
+
+TEST(StringBuilderTests, canMoveAnotherBuilderToTheEnd)
+{
+    StringBuilder b;
+    StringBuilder c;
+
+    for (unsigned int i = 0; i < 1000; ++i)
+    {
+        b.append(String{"Boo is the best dog there is, all day and all night. "});
+    }
+
+    for (unsigned int i = 0; i < 10; ++i)
+    {
+        c.append(String{"Boo is sleeping now, on the couch, as usual. Shhhh! "});
+    }
+
+    unsigned int total = b.length() + c.length();
+    b.append(static_cast<StringBuilder&&>(c));
+
+    EXPECT_TRUE(c.isEmpty());
+    EXPECT_EQ(total, b.length());
+    EXPECT_EQ('B', b.at(53000));
+    EXPECT_EQ('!', b.at(total - 2));
+
+    String s = b.toString();
+    EXPECT_EQ(total, s.length());
+    EXPECT_EQ(53000, s.find(String{"Boo is sleeping"}));
+}
+
+
+TEST(StringBuilderTests, copiesAreIndependent)
+{
+    StringBuilder b;
+    b.append(String{"Boo is the very best dog in the world. "});
+
+    StringBuilder c{b};
+    c.append(String{"Really."});
+
+    EXPECT_STREQ("Boo is the very best dog in the world. ", b.toString().toChars());
+    EXPECT_STREQ("Boo is the very best dog in the world. Really.", c.toString().toChars());
+}
+
+
+TEST(StringBuilderTests, manySmallPiecesAreJoinedCorrectly)
+{
+    StringBuilder b;
+    String expected;
+
+    for (unsigned int i = 0; i < 500; ++i)
+    {
+        String piece{i % 2 == 0 ? "Boo" : ", "};
+        b.append(piece);
+        expected.append(piece);
+    }
+
+    EXPECT_TRUE(b.toString().equals(expected));
+}
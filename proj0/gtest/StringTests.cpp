@@ -10,6 +10,8 @@
 // be testing your implementation more thoroughly, so you might want to
 // write your own tests, as well.)
 
+#include <thread>
+#include <vector>
 #include <gtest/gtest.h>
 #include "OutOfBoundsException.hpp"
 #include "String.hpp"
@@ -291,3 +293,296 @@ TEST(StringTests, toCharsReturnsNullTerminatedCStyleString)
     EXPECT_STREQ(chars, s.toChars());
 }
 
+
+
+TEST(StringTests, canMoveConstructFromAnotherString)
+{
+    const char* chars = "Boo is chasing the vacuum cleaner again";
+
+    String s{chars};
+    String t{static_cast<String&&>(s)};
+
+    EXPECT_EQ(39, t.length());
+    EXPECT_STREQ(chars, t.toChars());
+    EXPECT_TRUE(s.isEmpty());
+}
+
+
+TEST(StringTests, canMoveAssignFromAnotherString)
+{
+    String s{"Boo"};
+    String t{"Boo has been sleeping all afternoon"};
+
+    s = static_cast<String&&>(t);
+
+    EXPECT_STREQ("Boo has been sleeping all afternoon", s.toChars());
+    EXPECT_TRUE(t.isEmpty());
+}
+
+
+TEST(StringTests, shortStringsAreStoredWithinTheObject)
+{
+    String s{"Boo is short"};
+
+    const char* begin = reinterpret_cast<const char*>(&s);
+    const char* end = begin + sizeof(String);
+
+    EXPECT_GE(s.toChars(), begin);
+    EXPECT_LT(s.toChars(), end);
+}
+
+
+TEST(StringTests, copiesOfLongStringsAreIndependent)
+{
+    String s{"Boo is the best dog in the whole world"};
+    String t{s};
+
+    t.at(0) = 'Z';
+
+    EXPECT_EQ('B', s.at(0));
+    EXPECT_EQ('Z', t.at(0));
+}
+
+
+TEST(StringTests, canAppendStringToItself)
+{
+    String s{"Boo is barking! "};
+    s.append(s);
+
+    EXPECT_STREQ("Boo is barking! Boo is barking! ", s.toChars());
+}
+
+
+TEST(StringTests, canObtainSubstringReachingTheEnd)
+{
+    String s{"Every day is Boo's day"};
+    String t = s.substring(13, 22);
+
+    EXPECT_STREQ("Boo's day", t.toChars());
+}
+
+
+TEST(StringTests, appendingRepeatedlyGrowsCapacityGeometrically)
+{
+    String s;
+    String piece{"Boo "};
+    unsigned int reallocations = 0;
+    unsigned int lastCapacity = s.capacity();
+
+    for (unsigned int i = 0; i < 1000; ++i)
+    {
+        s.append(piece);
+
+        if (s.capacity() != lastCapacity)
+        {
+            ++reallocations;
+            lastCapacity = s.capacity();
+        }
+    }
+
+    EXPECT_EQ(4000, s.length());
+    EXPECT_GE(s.capacity(), s.length());
+    EXPECT_LE(reallocations, 12);
+    EXPECT_EQ('B', s.at(3996));
+}
+
+
+TEST(StringTests, reserveAvoidsLaterReallocation)
+{
+    String s{"Boo"};
+    s.reserve(100);
+
+    const char* before = s.toChars();
+
+    for (unsigned int i = 0; i < 32; ++i)
+    {
+        s.append(String{"!!!"});
+    }
+
+    EXPECT_GE(s.capacity(), 100);
+    EXPECT_EQ(before, s.toChars());
+    EXPECT_EQ(99, s.length());
+}
+
+
+TEST(StringTests, shrinkToFitReleasesUnusedCapacity)
+{
+    String s{"Boo is sleeping on the couch again"};
+    s.reserve(500);
+    s.shrinkToFit();
+
+    EXPECT_EQ(34, s.capacity());
+    EXPECT_STREQ("Boo is sleeping on the couch again", s.toChars());
+}
+
+
+TEST(StringTests, clearKeepsCapacity)
+{
+    String s;
+    s.reserve(64);
+    s.append(String{"Boo is asleep on the rug"});
+    s.clear();
+
+    EXPECT_TRUE(s.isEmpty());
+    EXPECT_GE(s.capacity(), 64);
+    EXPECT_STREQ("", s.toChars());
+}
+
+
+TEST(StringTests, canFindSubstringsAfterAPartialMatch)
+{
+    String s{"Boo bo boo Boolean"};
+
+    EXPECT_EQ(11, s.find(String{"Bool"}));
+    EXPECT_EQ(-1, s.find(String{"Booo"}));
+    EXPECT_TRUE(s.contains(String{"o Bool"}));
+}
+
+
+TEST(StringTests, canFindLongSubstringsInLongStrings)
+{
+    String needle{"Boo is the very best dog there ever was"};
+    String s;
+
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+        s.append(String{"Boo is the very best dog there ever is; "});
+    }
+
+    EXPECT_EQ(-1, s.find(needle));
+
+    s.append(needle);
+
+    EXPECT_EQ(4000, s.find(needle));
+    EXPECT_EQ(4000, s.rfind(needle));
+}
+
+
+TEST(StringTests, rfindReturnsLastOccurrence)
+{
+    String s{"Boo, Boo, and more Boo"};
+
+    EXPECT_EQ(19, s.rfind(String{"Boo"}));
+    EXPECT_EQ(21, s.rfind(String{"o"}));
+    EXPECT_EQ(-1, s.rfind(String{"cat"}));
+}
+
+
+TEST(StringTests, findAllReturnsEveryOccurrenceIncludingOverlapping)
+{
+    String s{"Boo said booooo"};
+    int indices[8];
+
+    unsigned int count = s.findAll(String{"oo"}, indices, 8);
+
+    EXPECT_EQ(5, count);
+    EXPECT_EQ(1, indices[0]);
+    EXPECT_EQ(10, indices[1]);
+    EXPECT_EQ(13, indices[4]);
+
+    EXPECT_EQ(5, s.findAll(String{"oo"}, indices, 2));
+    EXPECT_EQ(0, s.findAll(String{"cat"}, indices, 8));
+}
+
+
+TEST(StringTests, compareToOrdersPrefixesFirst)
+{
+    String s{"Boo is the very best dog in the world"};
+    String t{"Boo is the very best dog in the world!"};
+
+    EXPECT_LT(s.compareTo(t), 0);
+    EXPECT_GT(t.compareTo(s), 0);
+}
+
+
+TEST(StringTests, compareToFindsLateMismatches)
+{
+    String s{"Boo is the very best dog in the world, at least today"};
+    String t{"Boo is the very best dog in the world, at least todaz"};
+
+    EXPECT_LT(s.compareTo(t), 0);
+    EXPECT_GT(t.compareTo(s), 0);
+    EXPECT_FALSE(s.equals(t));
+}
+
+
+TEST(StringTests, equalStringsHaveEqualHashes)
+{
+    String s{"Boo is the very best dog in the world"};
+    String t{"Boo is the very best dog in the world"};
+
+    EXPECT_EQ(s.hash(), t.hash());
+    EXPECT_TRUE(s.equals(t));
+}
+
+
+TEST(StringTests, modifyingAStringChangesItsHash)
+{
+    String s{"Boo is the very best dog in the world"};
+    String t{s};
+    unsigned int before = s.hash();
+
+    s.at(0) = 'Z';
+
+    EXPECT_NE(before, s.hash());
+    EXPECT_FALSE(s.equals(t));
+
+    s.at(0) = 'B';
+
+    EXPECT_EQ(before, s.hash());
+    EXPECT_TRUE(s.equals(t));
+}
+
+
+TEST(StringTests, copiesOfLongStringsShareCharactersUntilModified)
+{
+    String s{"Boo is the very best dog in the world"};
+    String t{s};
+
+    EXPECT_EQ(s.toChars(), t.toChars());
+
+    t.append(String{"!"});
+
+    EXPECT_NE(s.toChars(), t.toChars());
+    EXPECT_STREQ("Boo is the very best dog in the world", s.toChars());
+    EXPECT_STREQ("Boo is the very best dog in the world!", t.toChars());
+}
+
+
+TEST(StringTests, charactersHandedOutByAtAreNotSharedWithLaterCopies)
+{
+    String s{"Boo is the very best dog in the world"};
+    char& c = s.at(0);
+    String t{s};
+
+    c = 'Z';
+
+    EXPECT_EQ('Z', s.at(0));
+    EXPECT_EQ('B', t.at(0));
+}
+
+
+TEST(StringTests, sharedStringsCanBeCopiedOnSeveralThreads)
+{
+    String s{"Boo is the very best dog in the world"};
+    std::vector<std::thread> threads;
+
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&s]
+        {
+            for (unsigned int j = 0; j < 10000; ++j)
+            {
+                String t{s};
+                t.append(String{"!"});
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_STREQ("Boo is the very best dog in the world", s.toChars());
+}
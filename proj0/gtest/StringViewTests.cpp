@@ -0,0 +1,110 @@
+// StringViewTests.cpp
+//
+// ICS 46 Spring 2020
+// Project #0: Getting to Know the ICS 46 VM
+//
+// Unit tests for StringView, and for the parts of String that produce
+// or accept them.
+
+#include <gtest/gtest.h>
+#include "OutOfBoundsException.hpp"
+#include "String.hpp"
+#include "StringView.hpp"
+
+
+TEST(StringViewTests, emptyWhenDefaultConstructed)
+{
+    StringView v;
+
+    EXPECT_TRUE(v.isEmpty());
+    EXPECT_EQ(0, v.length());
+}
+
+
+TEST(StringViewTests, viewOfStringRefersToItsCharacters)
+{
+    String s{"Boo is the very best dog in the world"};
+    StringView v = s.view();
+
+    EXPECT_EQ(s.toChars(), v.data());
+    EXPECT_EQ(37, v.length());
+    EXPECT_EQ('B', v.at(0));
+}
+
+
+TEST(StringViewTests, slicingDoesNotCopyCharacters)
+{
+    String s{"Every day is Boo's day"};
+    StringView v = s.view(13, 18);
+
+    EXPECT_EQ(s.toChars() + 13, v.data());
+    EXPECT_TRUE(v.equals(StringView{"Boo's"}));
+    EXPECT_TRUE(v.substring(0, 3).equals(StringView{"Boo"}));
+}
+
+
+TEST(StringViewTests, slicingOutOfBoundsFails)
+{
+    String s{"Boo's eyes are closed"};
+
+    EXPECT_THROW({ s.view(15, 100); }, OutOfBoundsException);
+    EXPECT_THROW({ s.view().substring(5, 4); }, OutOfBoundsException);
+    EXPECT_THROW({ s.view().at(21); }, OutOfBoundsException);
+}
+
+
+TEST(StringViewTests, canSearchAndCompareViews)
+{
+    String s{"Is Boo great today? Boo is great every day"};
+    StringView v = s.view();
+
+    EXPECT_EQ(3, v.find(StringView{"Boo"}));
+    EXPECT_EQ(20, v.rfind(StringView{"Boo"}));
+    EXPECT_TRUE(v.contains(StringView{"every"}));
+    EXPECT_FALSE(v.contains(StringView{"never"}));
+    EXPECT_LT(StringView{"earlier"}.compareTo(StringView{"later"}), 0);
+}
+
+
+TEST(StringViewTests, stringsCanBeSearchedAndComparedWithViews)
+{
+    String s{"Is Boo great today?"};
+    String t{"Boo is great, Boo is"};
+
+    EXPECT_EQ(3, s.find(t.view(0, 3)));
+    EXPECT_TRUE(s.contains(t.view(7, 12)));
+    EXPECT_TRUE(t.view(0, 6).equals(t.view(14, 20)));
+    EXPECT_TRUE(String{"Boo"}.equals(t.view(0, 3)));
+    EXPECT_EQ(0, String{"Boo is"}.compareTo(t.view(14, 20)));
+}
+
+
+TEST(StringViewTests, canTokenizeWithoutBuildingStrings)
+{
+    String s{"Boo,is,the,best"};
+    StringView rest = s.view();
+    StringView comma{","};
+    unsigned int tokens = 0;
+
+    while (!rest.isEmpty())
+    {
+        int index = rest.find(comma);
+        unsigned int end = index < 0 ? rest.length() : index;
+
+        EXPECT_FALSE(rest.substring(0, end).isEmpty());
+        tokens++;
+
+        rest = rest.substring(index < 0 ? end : end + 1, rest.length());
+    }
+
+    EXPECT_EQ(4, tokens);
+}
+
+
+TEST(StringViewTests, canBuildStringFromView)
+{
+    String s{"Every day is Boo's day"};
+    String t{s.view(13, 18)};
+
+    EXPECT_STREQ("Boo's", t.toChars());
+}
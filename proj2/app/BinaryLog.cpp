@@ -0,0 +1,340 @@
+// BinaryLog.cpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+
+#include <cstring>
+#include <stdexcept>
+#include "BinaryLog.hpp"
+
+
+namespace
+{
+    const char header[] = "SIMLOG1\n";
+    constexpr unsigned int headerLength = sizeof(header) - 1;
+
+    enum RecordKind : unsigned int
+    {
+        START,
+        ENTERED_LINE,
+        EXITED_LINE,
+        ENTERED_REGISTER,
+        EXITED_REGISTER,
+        LOST,
+        END,
+        STATS
+    };
+
+    constexpr unsigned int KIND_BITS = 3;
+    constexpr unsigned int KIND_MASK = (1 << KIND_BITS) - 1;
+
+    //The largest time difference that fits in a record's first byte; this
+    //value itself means that the rest of the difference follows
+    constexpr unsigned long long INLINE_DELTA_LIMIT = 0xff >> KIND_BITS;
+
+
+    unsigned long long zigzag(long long number)
+    {
+        return number < 0
+            ? ~(static_cast<unsigned long long>(number) << 1)
+            : static_cast<unsigned long long>(number) << 1;
+    }
+
+
+    long long unzigzag(unsigned long long number)
+    {
+        return (number & 1) ? ~static_cast<long long>(number >> 1) : static_cast<long long>(number >> 1);
+    }
+
+
+    // Reads a BinaryLog's stream in large blocks, handing out its bytes
+    // and numbers one at a time
+    class Reader
+    {
+    public:
+        explicit Reader(std::FILE* in)
+            : in{in}, used{0}, available{0}
+        {
+        }
+
+        // Reads the next byte into the given variable and returns true,
+        // or returns false if the stream has ended
+        bool readByte(unsigned char& byte)
+        {
+            if (used == available)
+            {
+                available = std::fread(buffer, 1, sizeof(buffer), in);
+                used = 0;
+
+                if (available == 0)
+                {
+                    return false;
+                }
+            }
+
+            byte = buffer[used++];
+            return true;
+        }
+
+        unsigned char requireByte()
+        {
+            unsigned char byte;
+            if (!readByte(byte))
+            {
+                throw std::runtime_error{"binary log ends partway through a record"};
+            }
+
+            return byte;
+        }
+
+        unsigned long long readUnsigned()
+        {
+            unsigned long long number = 0;
+            unsigned int shift = 0;
+            unsigned char byte;
+
+            do
+            {
+                if (shift >= 64)
+                {
+                    throw std::runtime_error{"binary log has a number that's too long"};
+                }
+
+                byte = requireByte();
+                number |= static_cast<unsigned long long>(byte & 0x7f) << shift;
+                shift += 7;
+            }
+            while (byte & 0x80);
+
+            return number;
+        }
+
+        long long readSigned()
+        {
+            return unzigzag(readUnsigned());
+        }
+
+    private:
+        std::FILE* in;
+        unsigned char buffer[1 << 16];
+        unsigned int used;
+        unsigned int available;
+    };
+}
+
+
+BinaryLog::BinaryLog(std::FILE* out)
+    : out{out}, used{headerLength}, previousTime{0}
+{
+    std::memcpy(buffer, header, headerLength);
+}
+
+
+BinaryLog::~BinaryLog()
+{
+    flush();
+}
+
+
+void BinaryLog::start()
+{
+    startRecord(START, 0);
+}
+
+
+void BinaryLog::enteredLine(int time, unsigned int line, unsigned int length)
+{
+    startRecord(ENTERED_LINE, time);
+    writeUnsigned(line);
+    writeUnsigned(length);
+}
+
+
+void BinaryLog::exitedLine(int time, unsigned int line, unsigned int length, int timeWaited)
+{
+    startRecord(EXITED_LINE, time);
+    writeUnsigned(line);
+    writeUnsigned(length);
+    writeSigned(timeWaited);
+}
+
+
+void BinaryLog::enteredRegister(int time, unsigned int reg)
+{
+    startRecord(ENTERED_REGISTER, time);
+    writeUnsigned(reg);
+}
+
+
+void BinaryLog::exitedRegister(int time, unsigned int reg)
+{
+    startRecord(EXITED_REGISTER, time);
+    writeUnsigned(reg);
+}
+
+
+void BinaryLog::lost(int time)
+{
+    startRecord(LOST, time);
+}
+
+
+void BinaryLog::end(int time)
+{
+    startRecord(END, time);
+}
+
+
+void BinaryLog::stats(const SimulationStats& stats)
+{
+    startRecord(STATS, previousTime);
+    writeSigned(stats.enteredLine);
+    writeSigned(stats.exitedLine);
+    writeSigned(stats.exitedRegister);
+    writeSigned(stats.totalTimeWaited);
+    writeSigned(stats.leftInLine);
+    writeSigned(stats.leftInRegister);
+    writeSigned(stats.lost);
+    flush();
+}
+
+
+void BinaryLog::flush()
+{
+    if (used > 0)
+    {
+        std::fwrite(buffer, 1, used, out);
+        used = 0;
+    }
+
+    std::fflush(out);
+}
+
+
+//Writes out the buffer if there might not be room in it for another
+//record, then writes the record's first byte (and, if it doesn't fit
+//there, the rest of its time difference)
+void BinaryLog::startRecord(unsigned int kind, int time)
+{
+    if (BUFFER_SIZE - used < LONGEST_RECORD)
+    {
+        std::fwrite(buffer, 1, used, out);
+        used = 0;
+    }
+
+    unsigned long long delta = zigzag(static_cast<long long>(time) - previousTime);
+    previousTime = time;
+
+    if (delta < INLINE_DELTA_LIMIT)
+    {
+        buffer[used++] = kind | (delta << KIND_BITS);
+    }
+    else
+    {
+        buffer[used++] = kind | (INLINE_DELTA_LIMIT << KIND_BITS);
+        writeUnsigned(delta - INLINE_DELTA_LIMIT);
+    }
+}
+
+
+void BinaryLog::writeUnsigned(unsigned long long number)
+{
+    while (number >= 0x80)
+    {
+        buffer[used++] = (number & 0x7f) | 0x80;
+        number >>= 7;
+    }
+
+    buffer[used++] = number;
+}
+
+
+void BinaryLog::writeSigned(long long number)
+{
+    writeUnsigned(zigzag(number));
+}
+
+
+void decodeBinaryLog(std::FILE* in, SimulationLog& log)
+{
+    Reader reader{in};
+
+    for (unsigned int i = 0; i < headerLength; ++i)
+    {
+        unsigned char byte;
+        if (!reader.readByte(byte) || byte != static_cast<unsigned char>(header[i]))
+        {
+            throw std::runtime_error{"not a binary simulation log"};
+        }
+    }
+
+    long long time = 0;
+    unsigned char first;
+
+    while (reader.readByte(first))
+    {
+        unsigned long long delta = first >> KIND_BITS;
+        if (delta == INLINE_DELTA_LIMIT)
+        {
+            delta += reader.readUnsigned();
+        }
+
+        time += unzigzag(delta);
+
+        switch (first & KIND_MASK)
+        {
+        case START:
+            log.start();
+            break;
+
+        case ENTERED_LINE:
+        {
+            unsigned int line = reader.readUnsigned();
+            unsigned int length = reader.readUnsigned();
+            log.enteredLine(time, line, length);
+            break;
+        }
+
+        case EXITED_LINE:
+        {
+            unsigned int line = reader.readUnsigned();
+            unsigned int length = reader.readUnsigned();
+            int timeWaited = reader.readSigned();
+            log.exitedLine(time, line, length, timeWaited);
+            break;
+        }
+
+        case ENTERED_REGISTER:
+            log.enteredRegister(time, reader.readUnsigned());
+            break;
+
+        case EXITED_REGISTER:
+            log.exitedRegister(time, reader.readUnsigned());
+            break;
+
+        case LOST:
+            log.lost(time);
+            break;
+
+        case END:
+            log.end(time);
+            break;
+
+        case STATS:
+        {
+            SimulationStats stats;
+            stats.enteredLine = reader.readSigned();
+            stats.exitedLine = reader.readSigned();
+            stats.exitedRegister = reader.readSigned();
+            stats.totalTimeWaited = reader.readSigned();
+            stats.leftInLine = reader.readSigned();
+            stats.leftInRegister = reader.readSigned();
+            stats.lost = reader.readSigned();
+            log.stats(stats);
+            break;
+        }
+        }
+    }
+
+    log.flush();
+}
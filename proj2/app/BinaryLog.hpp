@@ -0,0 +1,84 @@
+// BinaryLog.hpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// A BinaryLog writes a simulation's log and statistics as a stream of
+// compact binary records, which are much cheaper to produce than text
+// and usually a fraction of its size.  decodeBinaryLog() reads such a
+// stream back and replays it into another log -- a TextLog, say, to get
+// exactly the text that the simulation would have written.
+//
+// The stream starts with the eight bytes "SIMLOG1\n", followed by one
+// record per event.  A record starts with a byte whose low three bits
+// say what kind of event it is and whose high five bits say how much
+// later it happened than the event before it.  (Events are nearly always
+// at the same time as the previous one or shortly after, so this is
+// usually enough; if not, those bits are all ones and the rest of the
+// difference follows.)  The event's other fields follow, in the order
+// SimulationLog's member functions take them.
+//
+// All numbers beyond that first byte are written seven bits at a time,
+// least significant first, with the high bit of each byte set when more
+// follow.  Numbers that could be negative are first mapped to unsigned
+// ones (0, -1, 1, -2, ... become 0, 1, 2, 3, ...) so that small values
+// of either sign stay short.
+
+#ifndef BINARYLOG_HPP
+#define BINARYLOG_HPP
+
+#include <cstdio>
+#include "SimulationLog.hpp"
+
+
+
+class BinaryLog : public SimulationLog
+{
+public:
+    // Initializes a log that writes to the given file, which it doesn't
+    // own, starting with the stream's header.
+    explicit BinaryLog(std::FILE* out);
+
+    ~BinaryLog() override;
+
+    BinaryLog(const BinaryLog&) = delete;
+    BinaryLog& operator=(const BinaryLog&) = delete;
+
+    void start() override;
+    void enteredLine(int time, unsigned int line, unsigned int length) override;
+    void exitedLine(int time, unsigned int line, unsigned int length, int timeWaited) override;
+    void enteredRegister(int time, unsigned int reg) override;
+    void exitedRegister(int time, unsigned int reg) override;
+    void lost(int time) override;
+    void end(int time) override;
+    void stats(const SimulationStats& stats) override;
+    void flush() override;
+
+private:
+    static constexpr unsigned int BUFFER_SIZE = 1 << 16;
+
+    // The most that any one record can take: its first byte, then at
+    // most eight numbers of at most ten bytes each.
+    static constexpr unsigned int LONGEST_RECORD = 1 + 8 * 10;
+
+    std::FILE* out;
+    unsigned char buffer[BUFFER_SIZE];
+    unsigned int used;
+    int previousTime;
+
+    void startRecord(unsigned int kind, int time);
+    void writeUnsigned(unsigned long long number);
+    void writeSigned(long long number);
+};
+
+
+
+// decodeBinaryLog() reads a stream written by a BinaryLog and replays
+// each of its records, in order, into the given log.  It throws a
+// std::runtime_error if the stream isn't one, or if it ends partway
+// through a record.
+void decodeBinaryLog(std::FILE* in, SimulationLog& log);
+
+
+
+#endif // BINARYLOG_HPP
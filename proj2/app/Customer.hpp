@@ -0,0 +1,22 @@
+// Customer.hpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// A Customer is someone waiting in one of the simulation's lines.  All
+// we need to know about them is when they got in line, so we can tell
+// how long they waited.
+
+#ifndef CUSTOMER_HPP
+#define CUSTOMER_HPP
+
+
+
+struct Customer
+{
+    int timeEnteredLine;
+};
+
+
+
+#endif // CUSTOMER_HPP
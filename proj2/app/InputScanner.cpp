@@ -0,0 +1,104 @@
+// InputScanner.cpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+
+#include "InputScanner.hpp"
+
+
+namespace
+{
+    bool isWhitespace(int c)
+    {
+        return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+    }
+
+
+    bool isDigit(int c)
+    {
+        return c >= '0' && c <= '9';
+    }
+}
+
+
+InputScanner::InputScanner(std::FILE* in)
+    : in{in}, position{0}, available{0}
+{
+}
+
+
+bool InputScanner::nextInt(int& value)
+{
+    if (!skipWhitespace())
+    {
+        return false;
+    }
+
+    //The digit after a '-' may be in the next block, so the '-' has to be
+    //moved past before it can be seen
+    bool negative = buffer[position] == '-';
+    if (negative)
+    {
+        ++position;
+    }
+
+    if (!isDigit(peek()))
+    {
+        return false;
+    }
+
+    unsigned int magnitude = 0;
+    int c;
+
+    while (isDigit(c = peek()))
+    {
+        magnitude = magnitude * 10 + (c - '0');
+        ++position;
+    }
+
+    value = negative ? -static_cast<int>(magnitude) : static_cast<int>(magnitude);
+    return true;
+}
+
+
+bool InputScanner::nextWord(std::string& word)
+{
+    if (!skipWhitespace())
+    {
+        return false;
+    }
+
+    word.clear();
+    int c;
+
+    while ((c = peek()) != EOF && !isWhitespace(c))
+    {
+        word.push_back(static_cast<char>(c));
+        ++position;
+    }
+
+    return true;
+}
+
+
+//Reads the next block of the file into the buffer, returning false if
+//there's nothing left
+bool InputScanner::refill()
+{
+    position = 0;
+    available = std::fread(buffer, 1, BUFFER_SIZE, in);
+    return available > 0;
+}
+
+
+//Moves past whitespace, returning false if the input ends first
+bool InputScanner::skipWhitespace()
+{
+    int c;
+    while (isWhitespace(c = peek()))
+    {
+        ++position;
+    }
+
+    return c != EOF;
+}
@@ -0,0 +1,69 @@
+// InputScanner.hpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// An InputScanner reads whitespace-separated integers and words from a
+// file, such as the standard input.  It reads the file in large blocks
+// into a buffer of its own and picks the tokens out of that buffer
+// itself, so reading each integer costs a handful of comparisons rather
+// than a trip through an iostream's locale, sentry, and locking.  Only
+// one block is held at a time, so input of any size can be read as it
+// arrives.
+
+#ifndef INPUTSCANNER_HPP
+#define INPUTSCANNER_HPP
+
+#include <cstdio>
+#include <string>
+
+
+
+class InputScanner
+{
+public:
+    // Initializes a scanner that reads from the given file, which it
+    // doesn't own.
+    explicit InputScanner(std::FILE* in);
+
+    InputScanner(const InputScanner&) = delete;
+    InputScanner& operator=(const InputScanner&) = delete;
+
+    // nextInt() skips whitespace, then reads an integer (optionally
+    // preceded by a '-') into the given variable and returns true.  If
+    // the input ends, or the next token doesn't start with an integer,
+    // it returns false instead, having read no more than a '-'.
+    bool nextInt(int& value);
+
+    // nextWord() skips whitespace, then reads everything up to the next
+    // whitespace into the given string and returns true, or returns
+    // false if the input ends first.
+    bool nextWord(std::string& word);
+
+private:
+    static constexpr unsigned int BUFFER_SIZE = 1 << 16;
+
+    std::FILE* in;
+    char buffer[BUFFER_SIZE];
+    unsigned int position;
+    unsigned int available;
+
+    bool refill();
+    bool skipWhitespace();
+
+    // Returns the next character without reading it, or EOF if the input
+    // has ended
+    int peek()
+    {
+        if (position == available && !refill())
+        {
+            return EOF;
+        }
+
+        return static_cast<unsigned char>(buffer[position]);
+    }
+};
+
+
+
+#endif // INPUTSCANNER_HPP
@@ -0,0 +1,71 @@
+// ShortestLineFinder.cpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+
+#include <climits>
+#include "ShortestLineFinder.hpp"
+
+
+ShortestLineFinder::ShortestLineFinder(unsigned int lineCount)
+    : leafCount{1}
+{
+    while (leafCount < lineCount)
+    {
+        leafCount *= 2;
+    }
+
+    //Leaves past the last real line are "infinitely long" so they're
+    //never the shortest
+    lengths.assign(leafCount, INT_MAX);
+    for (unsigned int line = 0; line < lineCount; ++line)
+    {
+        lengths[line] = 0;
+    }
+
+    tree.resize(2 * leafCount);
+    for (unsigned int line = 0; line < leafCount; ++line)
+    {
+        tree[leafCount + line] = line;
+    }
+    for (unsigned int node = leafCount - 1; node > 0; --node)
+    {
+        tree[node] = shorterOf(tree[2 * node], tree[2 * node + 1]);
+    }
+}
+
+
+void ShortestLineFinder::setLength(unsigned int line, int length)
+{
+    lengths[line] = length;
+
+    for (unsigned int node = (leafCount + line) / 2; node > 0; node /= 2)
+    {
+        tree[node] = shorterOf(tree[2 * node], tree[2 * node + 1]);
+    }
+}
+
+
+unsigned int ShortestLineFinder::shortest() const
+{
+    return tree[1];
+}
+
+
+int ShortestLineFinder::shortestLength() const
+{
+    return lengths[shortest()];
+}
+
+
+unsigned int ShortestLineFinder::shorterOf(unsigned int a, unsigned int b) const
+{
+    if (lengths[b] < lengths[a] || (lengths[b] == lengths[a] && b < a))
+    {
+        return b;
+    }
+    else
+    {
+        return a;
+    }
+}
@@ -0,0 +1,50 @@
+// ShortestLineFinder.hpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// A ShortestLineFinder keeps track of the lengths of a fixed number of
+// lines and can say which of them is the shortest (the lowest-numbered
+// one, if there's a tie).  It's a segment tree: each node knows the
+// shortest line among those below it, so changing a line's length or
+// asking for the shortest line both take O(log n) time, where n is the
+// number of lines, rather than requiring a look at every line.
+
+#ifndef SHORTESTLINEFINDER_HPP
+#define SHORTESTLINEFINDER_HPP
+
+#include <vector>
+
+
+
+class ShortestLineFinder
+{
+public:
+    // Initializes a finder for the given number of lines (at least one),
+    // all of which are initially empty.
+    explicit ShortestLineFinder(unsigned int lineCount);
+
+    // setLength() records the current length of one of the lines.
+    void setLength(unsigned int line, int length);
+
+    // shortest() returns the index of the shortest line, and
+    // shortestLength() returns its length.
+    unsigned int shortest() const;
+    int shortestLength() const;
+
+private:
+    unsigned int leafCount;
+    std::vector<int> lengths;
+
+    // tree[1] is the root; the children of tree[i] are tree[2 * i] and
+    // tree[2 * i + 1]; the leaves, starting at tree[leafCount], are the
+    // lines themselves.  Each node holds the index of the shortest line
+    // below it.
+    std::vector<unsigned int> tree;
+
+    unsigned int shorterOf(unsigned int a, unsigned int b) const;
+};
+
+
+
+#endif // SHORTESTLINEFINDER_HPP
@@ -0,0 +1,229 @@
+// Simulation.cpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+
+#include <algorithm>
+#include "Simulation.hpp"
+
+
+Simulation::Simulation(const SimulationSettings& settings)
+    : settings{settings},
+      lines(settings.singleLine ? 1 : settings.registerTimes.size()),
+      registers(settings.registerTimes.size(), Register{false, 0}),
+      departures{static_cast<unsigned int>(registers.size())},
+      shortestLine{static_cast<unsigned int>(lines.size())},
+      stats{0, 0, 0, 0, 0, 0, 0}
+{
+    if (settings.singleLine)
+    {
+        for (unsigned int reg = 0; reg < registers.size(); ++reg)
+        {
+            idleRegisters.insert(idleRegisters.end(), reg);
+        }
+    }
+}
+
+
+void Simulation::start()
+{
+    if (settings.log != nullptr)
+    {
+        settings.log->start();
+    }
+}
+
+
+void Simulation::addCustomers(int count, int time)
+{
+    if (time >= settings.length)
+    {
+        return;
+    }
+
+    simulateUntil(time);
+
+    for (int i = 0; i < count; ++i)
+    {
+        arrive(time);
+    }
+
+    visitRegisters(time);
+}
+
+
+SimulationStats Simulation::finish()
+{
+    simulateUntil(settings.length);
+
+    if (settings.log != nullptr)
+    {
+        settings.log->end(settings.length);
+    }
+
+    stats.leftInLine = 0;
+    for (const RingQueue<Customer>& line : lines)
+    {
+        stats.leftInLine += line.size();
+    }
+
+    stats.leftInRegister = 0;
+    for (const Register& reg : registers)
+    {
+        if (reg.busy)
+        {
+            stats.leftInRegister++;
+        }
+    }
+
+    return stats;
+}
+
+
+unsigned int Simulation::lineOf(unsigned int reg) const
+{
+    return settings.singleLine ? 0 : reg;
+}
+
+
+void Simulation::setLineLength(unsigned int line)
+{
+    shortestLine.setLength(line, lines[line].size());
+}
+
+
+//Plays out every register finishing with its customer before the given
+//time, in the order they happen
+void Simulation::simulateUntil(int time)
+{
+    while (!departures.isEmpty() && departures.frontPriority() < time)
+    {
+        unsigned int reg = departures.front();
+        int departureTime = departures.frontPriority();
+        departures.dequeue();
+
+        leaveRegister(reg, departureTime);
+        takeNextCustomer(reg, departureTime);
+    }
+}
+
+
+//Puts an arriving customer in the shortest line, unless every line is full
+void Simulation::arrive(int time)
+{
+    unsigned int line = shortestLine.shortest();
+
+    if (shortestLine.shortestLength() >= settings.maxLineLength)
+    {
+        stats.lost++;
+        if (settings.log != nullptr)
+        {
+            settings.log->lost(time);
+        }
+        return;
+    }
+
+    lines[line].enqueue(Customer{time});
+    setLineLength(line);
+    stats.enteredLine++;
+    if (settings.log != nullptr)
+    {
+        settings.log->enteredLine(time, line, lines[line].size());
+    }
+
+    //An idle register whose line was empty has to be visited to take
+    //this customer
+    if (!settings.singleLine && !registers[line].busy && lines[line].size() == 1)
+    {
+        registersToVisit.push_back(line);
+    }
+}
+
+
+//Visits, in order, every register that has something to do at the given
+//time: those finishing with a customer, and idle ones with customers
+//waiting for them
+void Simulation::visitRegisters(int time)
+{
+    while (!departures.isEmpty() && departures.frontPriority() == time)
+    {
+        registersToVisit.push_back(departures.front());
+        departures.dequeue();
+    }
+
+    if (settings.singleLine)
+    {
+        //Only as many idle registers as there are customers waiting can
+        //possibly take one
+        unsigned int waiting = lines[0].size();
+        for (auto i = idleRegisters.begin(); i != idleRegisters.end() && waiting > 0; ++i, --waiting)
+        {
+            registersToVisit.push_back(*i);
+        }
+    }
+
+    std::sort(registersToVisit.begin(), registersToVisit.end());
+
+    for (unsigned int reg : registersToVisit)
+    {
+        if (registers[reg].busy)
+        {
+            leaveRegister(reg, time);
+        }
+        takeNextCustomer(reg, time);
+    }
+
+    registersToVisit.clear();
+}
+
+
+void Simulation::leaveRegister(unsigned int reg, int time)
+{
+    stats.exitedRegister++;
+    if (settings.log != nullptr)
+    {
+        settings.log->exitedRegister(time, reg);
+    }
+
+    registers[reg].busy = false;
+    if (settings.singleLine)
+    {
+        idleRegisters.insert(reg);
+    }
+}
+
+
+//Moves the next customer in a register's line to the register, if there's
+//anyone in line, scheduling when the register will finish with them
+bool Simulation::takeNextCustomer(unsigned int reg, int time)
+{
+    unsigned int line = lineOf(reg);
+    if (lines[line].isEmpty())
+    {
+        return false;
+    }
+
+    int timeWaited = time - lines[line].front().timeEnteredLine;
+    lines[line].dequeue();
+    setLineLength(line);
+
+    stats.exitedLine++;
+    stats.totalTimeWaited += timeWaited;
+
+    if (settings.log != nullptr)
+    {
+        settings.log->exitedLine(time, line, lines[line].size(), timeWaited);
+        settings.log->enteredRegister(time, reg);
+    }
+
+    registers[reg].busy = true;
+    registers[reg].finishTime = time + settings.registerTimes[reg];
+    departures.enqueue(reg, registers[reg].finishTime);
+
+    if (settings.singleLine)
+    {
+        idleRegisters.erase(reg);
+    }
+
+    return true;
+}
@@ -0,0 +1,118 @@
+// Simulation.hpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// A Simulation simulates customers moving through the lines and
+// registers of a store, logging each thing that happens, in order, as
+// it goes.  It's driven by telling it about each batch of customers that
+// arrive, in order of their arrival times; after the last one, finish()
+// plays out the rest of the simulation and returns its statistics.
+//
+// The simulation is event-driven: rather than visiting every register
+// or line to see what has changed, it keeps a heap of the times at which
+// busy registers will finish with their customers, keyed by register, so
+// it can jump from one of those events to the next, and it keeps track
+// of which line is shortest as lines change.  The cost of each event is
+// then logarithmic in the number of registers, no matter how many there
+// are.
+//
+// Events happening at the same time are handled the way the original
+// simulation handled them: new arrivals get in line first, then the
+// registers, in order, let their customers go and take the next ones.
+
+#ifndef SIMULATION_HPP
+#define SIMULATION_HPP
+
+#include <set>
+#include <vector>
+#include "Customer.hpp"
+#include "IndexedPriorityQueue.hpp"
+#include "RingQueue.hpp"
+#include "ShortestLineFinder.hpp"
+#include "SimulationLog.hpp"
+#include "SimulationStats.hpp"
+
+
+
+struct SimulationSettings
+{
+    // How long the simulation runs, in seconds.
+    int length = 0;
+
+    // The most customers that can be waiting in any one line.
+    int maxLineLength = 0;
+
+    // Whether there's a single line that feeds every register, rather
+    // than one line per register.
+    bool singleLine = false;
+
+    // How long each register takes to finish with a customer, in seconds.
+    std::vector<int> registerTimes;
+
+    // The log that's told what happens, or nullptr if it isn't needed
+    // (e.g., when only the statistics matter).  The simulation doesn't
+    // own it.
+    SimulationLog* log = nullptr;
+};
+
+
+
+class Simulation
+{
+public:
+    explicit Simulation(const SimulationSettings& settings);
+
+    // start() logs the start of the simulation.
+    void start();
+
+    // addCustomers() adds a batch of customers that arrive at the given
+    // time, first simulating everything that happens before then.  Times
+    // must not decrease from one call to the next.  Customers arriving
+    // once the simulation has ended are ignored.
+    void addCustomers(int count, int time);
+
+    // finish() simulates everything that happens between the last batch
+    // of customers and the end of the simulation, then logs the end of
+    // the simulation and returns its statistics.
+    SimulationStats finish();
+
+private:
+    struct Register
+    {
+        bool busy;
+        int finishTime;
+    };
+
+    SimulationSettings settings;
+
+    std::vector<RingQueue<Customer>> lines;
+    std::vector<Register> registers;
+
+    // The busy registers, by the time they'll finish with their customers;
+    // registers finishing at the same time come out in order.
+    IndexedPriorityQueue<int> departures;
+    ShortestLineFinder shortestLine;
+
+    // In the single-line setup, the idle registers, in order, so that the
+    // lowest-numbered one can take the next customer.  In the multi-line
+    // setup, the idle registers whose lines have had customers arrive
+    // since the registers were last visited.
+    std::set<unsigned int> idleRegisters;
+    std::vector<unsigned int> registersToVisit;
+
+    SimulationStats stats;
+
+    unsigned int lineOf(unsigned int reg) const;
+    void setLineLength(unsigned int line);
+
+    void simulateUntil(int time);
+    void arrive(int time);
+    void visitRegisters(int time);
+    void leaveRegister(unsigned int reg, int time);
+    bool takeNextCustomer(unsigned int reg, int time);
+};
+
+
+
+#endif // SIMULATION_HPP
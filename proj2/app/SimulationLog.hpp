@@ -0,0 +1,43 @@
+// SimulationLog.hpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// A SimulationLog is told about each thing that happens in a simulation,
+// in order, and about the simulation's statistics once it's finished.
+// What it does with them depends on the kind of log: a TextLog writes
+// them in the familiar text format, while a BinaryLog writes compact
+// records that can be turned into text later.  A simulation that needs
+// no log at all is given none, rather than one that ignores everything.
+//
+// Lines and registers are numbered from zero here; it's up to each kind
+// of log how to present them.
+
+#ifndef SIMULATIONLOG_HPP
+#define SIMULATIONLOG_HPP
+
+#include "SimulationStats.hpp"
+
+
+
+class SimulationLog
+{
+public:
+    virtual ~SimulationLog() = default;
+
+    virtual void start() = 0;
+    virtual void enteredLine(int time, unsigned int line, unsigned int length) = 0;
+    virtual void exitedLine(int time, unsigned int line, unsigned int length, int timeWaited) = 0;
+    virtual void enteredRegister(int time, unsigned int reg) = 0;
+    virtual void exitedRegister(int time, unsigned int reg) = 0;
+    virtual void lost(int time) = 0;
+    virtual void end(int time) = 0;
+    virtual void stats(const SimulationStats& stats) = 0;
+
+    // flush() writes out anything that the log is holding onto.
+    virtual void flush() = 0;
+};
+
+
+
+#endif // SIMULATIONLOG_HPP
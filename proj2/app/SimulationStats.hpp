@@ -0,0 +1,34 @@
+// SimulationStats.hpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// SimulationStats are the totals that a simulation reports once it's
+// finished.
+
+#ifndef SIMULATIONSTATS_HPP
+#define SIMULATIONSTATS_HPP
+
+
+
+struct SimulationStats
+{
+    int enteredLine;
+    int exitedLine;
+    int exitedRegister;
+    long long totalTimeWaited;
+    int leftInLine;
+    int leftInRegister;
+    int lost;
+
+    // averageWaitTime() returns the average time that the customers who
+    // exited their lines spent waiting in them.
+    float averageWaitTime() const
+    {
+        return (float)totalTimeWaited / (float)exitedLine;
+    }
+};
+
+
+
+#endif // SIMULATIONSTATS_HPP
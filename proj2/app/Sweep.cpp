@@ -0,0 +1,304 @@
+// Sweep.cpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include "Simulation.hpp"
+#include "Sweep.hpp"
+#include "WorkStealingPool.hpp"
+
+
+namespace
+{
+    const char* summaryHeader = "Registers  Max Line  Setup   Runs  Avg Wait  Best Wait  Worst Wait  Avg Lost  Lost %\n";
+    const char* summaryFormat = "%9d  %8d  %5s  %5d  %8.2f  %9.2f  %10.2f  %8.2f  %6.2f\n";
+
+
+    void readRange(std::istringstream& values, const std::string& name, int& min, int& max)
+    {
+        if (!(values >> min >> max) || min < 0 || max < min)
+        {
+            throw std::runtime_error{"sweep: '" + name + "' needs a least and a most value"};
+        }
+    }
+
+
+    template <typename T>
+    void readList(std::istringstream& values, const std::string& name, std::vector<T>& list)
+    {
+        T value;
+        while (values >> value)
+        {
+            list.push_back(value);
+        }
+
+        if (list.empty() || !values.eof())
+        {
+            throw std::runtime_error{"sweep: '" + name + "' needs a list of numbers"};
+        }
+    }
+
+
+    void readLineSetups(std::istringstream& values, std::vector<bool>& singleLines)
+    {
+        std::string setup;
+        while (values >> setup)
+        {
+            if (setup != "S" && setup != "M")
+            {
+                throw std::runtime_error{"sweep: line setups must be S or M"};
+            }
+
+            singleLines.push_back(setup == "S");
+        }
+    }
+
+
+    // Runs one simulation with the given settings, choosing its register
+    // times and arrivals from the given seed
+    SimulationStats runOne(
+        const SweepGrid& grid, int registerCount, int maxLineLength,
+        bool singleLine, unsigned int seed)
+    {
+        std::seed_seq registerSeed{seed, 0u};
+        std::mt19937 registerRandom{registerSeed};
+        std::uniform_int_distribution<int> registerTime{grid.minRegisterTime, grid.maxRegisterTime};
+
+        SimulationSettings settings;
+        settings.length = grid.length;
+        settings.maxLineLength = maxLineLength;
+        settings.singleLine = singleLine;
+        settings.log = nullptr;
+
+        for (int i = 0; i < registerCount; ++i)
+        {
+            settings.registerTimes.push_back(registerTime(registerRandom));
+        }
+
+        std::seed_seq arrivalSeed{seed, 1u};
+        std::mt19937 arrivalRandom{arrivalSeed};
+        std::uniform_int_distribution<int> arrivalGap{grid.minArrivalGap, grid.maxArrivalGap};
+        std::uniform_int_distribution<int> batchSize{grid.minBatchSize, grid.maxBatchSize};
+
+        Simulation simulation{settings};
+        simulation.start();
+
+        for (int time = 0; time < grid.length; time += arrivalGap(arrivalRandom))
+        {
+            simulation.addCustomers(batchSize(arrivalRandom), time);
+        }
+
+        return simulation.finish();
+    }
+
+
+    SweepSummary summarize(
+        int registerCount, int maxLineLength, bool singleLine,
+        const SimulationStats* runs, int runCount)
+    {
+        SweepSummary summary{registerCount, maxLineLength, singleLine, runCount, 0, 0, 0, 0, 0};
+
+        long long totalTimeWaited = 0;
+        long long exitedLine = 0;
+        long long lost = 0;
+        long long arrived = 0;
+
+        for (int i = 0; i < runCount; ++i)
+        {
+            const SimulationStats& run = runs[i];
+            totalTimeWaited += run.totalTimeWaited;
+            exitedLine += run.exitedLine;
+            lost += run.lost;
+            arrived += run.enteredLine + run.lost;
+
+            float wait = run.exitedLine > 0 ? run.averageWaitTime() : 0;
+            if (i == 0 || wait < summary.bestAverageWaitTime)
+            {
+                summary.bestAverageWaitTime = wait;
+            }
+            if (i == 0 || wait > summary.worstAverageWaitTime)
+            {
+                summary.worstAverageWaitTime = wait;
+            }
+        }
+
+        if (exitedLine > 0)
+        {
+            summary.averageWaitTime = (float)totalTimeWaited / (float)exitedLine;
+        }
+
+        if (runCount > 0)
+        {
+            summary.averageLost = (float)lost / (float)runCount;
+        }
+
+        if (arrived > 0)
+        {
+            summary.lostPercentage = 100.0f * (float)lost / (float)arrived;
+        }
+
+        return summary;
+    }
+}
+
+
+SweepGrid readSweepGrid(std::istream& in)
+{
+    SweepGrid grid{-1, {}, {}, {}, {}, 30, 90, 1, 20, 1, 4};
+
+    std::string line;
+    while (std::getline(in, line))
+    {
+        std::string::size_type comment = line.find('#');
+        if (comment != std::string::npos)
+        {
+            line.erase(comment);
+        }
+
+        std::istringstream values{line};
+        std::string name;
+        if (!(values >> name))
+        {
+            continue;
+        }
+
+        if (name == "length")
+        {
+            if (!(values >> grid.length) || grid.length <= 0)
+            {
+                throw std::runtime_error{"sweep: 'length' needs a positive number of minutes"};
+            }
+
+            grid.length *= 60;
+        }
+        else if (name == "registers")
+        {
+            readList(values, name, grid.registerCounts);
+        }
+        else if (name == "maxLineLengths")
+        {
+            readList(values, name, grid.maxLineLengths);
+        }
+        else if (name == "lineSetups")
+        {
+            readLineSetups(values, grid.singleLines);
+        }
+        else if (name == "seeds")
+        {
+            readList(values, name, grid.seeds);
+        }
+        else if (name == "registerTimes")
+        {
+            readRange(values, name, grid.minRegisterTime, grid.maxRegisterTime);
+        }
+        else if (name == "arrivalGaps")
+        {
+            readRange(values, name, grid.minArrivalGap, grid.maxArrivalGap);
+        }
+        else if (name == "batchSizes")
+        {
+            readRange(values, name, grid.minBatchSize, grid.maxBatchSize);
+        }
+        else
+        {
+            throw std::runtime_error{"sweep: unknown setting '" + name + "'"};
+        }
+    }
+
+    if (grid.length < 0 || grid.registerCounts.empty() || grid.maxLineLengths.empty()
+        || grid.singleLines.empty() || grid.seeds.empty())
+    {
+        throw std::runtime_error{
+            "sweep: length, registers, maxLineLengths, lineSetups, and seeds are required"};
+    }
+
+    if (grid.minArrivalGap == 0)
+    {
+        throw std::runtime_error{"sweep: arrival gaps must be at least one second"};
+    }
+
+    for (int registerCount : grid.registerCounts)
+    {
+        if (registerCount <= 0)
+        {
+            throw std::runtime_error{"sweep: register counts must be positive"};
+        }
+    }
+
+    return grid;
+}
+
+
+std::vector<SweepSummary> runSweep(const SweepGrid& grid, unsigned int threadCount)
+{
+    int seedCount = grid.seeds.size();
+    int combinationCount = grid.registerCounts.size() * grid.maxLineLengths.size() * grid.singleLines.size();
+
+    //Each run writes only its own element, so the runs needn't coordinate
+    std::vector<SimulationStats> runs(combinationCount * seedCount);
+
+    {
+        WorkStealingPool pool{threadCount};
+        int run = 0;
+
+        for (int registerCount : grid.registerCounts)
+        {
+            for (int maxLineLength : grid.maxLineLengths)
+            {
+                for (bool singleLine : grid.singleLines)
+                {
+                    for (unsigned int seed : grid.seeds)
+                    {
+                        SimulationStats* result = &runs[run++];
+                        pool.submit(
+                            [&grid, registerCount, maxLineLength, singleLine, seed, result]()
+                            {
+                                *result = runOne(grid, registerCount, maxLineLength, singleLine, seed);
+                            });
+                    }
+                }
+            }
+        }
+
+        pool.wait();
+    }
+
+    std::vector<SweepSummary> summaries;
+    int combination = 0;
+
+    for (int registerCount : grid.registerCounts)
+    {
+        for (int maxLineLength : grid.maxLineLengths)
+        {
+            for (bool singleLine : grid.singleLines)
+            {
+                summaries.push_back(summarize(
+                    registerCount, maxLineLength, singleLine,
+                    &runs[combination * seedCount], seedCount));
+
+                ++combination;
+            }
+        }
+    }
+
+    return summaries;
+}
+
+
+void printSweepSummaries(std::FILE* out, const std::vector<SweepSummary>& summaries)
+{
+    std::fprintf(out, "%s", summaryHeader);
+
+    for (const SweepSummary& summary : summaries)
+    {
+        std::fprintf(
+            out, summaryFormat, summary.registerCount, summary.maxLineLength,
+            summary.singleLine ? "S" : "M", summary.runs, summary.averageWaitTime,
+            summary.bestAverageWaitTime, summary.worstAverageWaitTime,
+            summary.averageLost, summary.lostPercentage);
+    }
+}
@@ -0,0 +1,95 @@
+// Sweep.hpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// A sweep runs the simulation over a grid of settings -- every
+// combination of register count, maximum line length, and line setup --
+// several times each, with customers arriving (and registers working)
+// at random, and summarizes how each combination did.  The runs are
+// independent of one another, so they're spread across every core.
+//
+// Each run is driven by a seed.  The same seed yields the same arrivals
+// and the same register times (for as many registers as there are) no
+// matter which combination of settings it's used with, so differences
+// between combinations come from the settings rather than from luck.
+//
+// A sweep's grid is read from a stream of lines, each a name followed
+// by its values, e.g.:
+//
+//     length 10            (minutes)
+//     registers 2 4 8
+//     maxLineLengths 3 10
+//     lineSetups S M
+//     seeds 1 2 3 4
+//     registerTimes 30 90  (least and most seconds per customer)
+//     arrivalGaps 1 20     (least and most seconds between batches)
+//     batchSizes 1 4       (least and most customers per batch)
+//
+// Blank lines and anything after a '#' are ignored.
+
+#ifndef SWEEP_HPP
+#define SWEEP_HPP
+
+#include <cstdio>
+#include <istream>
+#include <vector>
+
+
+
+struct SweepGrid
+{
+    // How long each simulation runs, in seconds.
+    int length;
+
+    std::vector<int> registerCounts;
+    std::vector<int> maxLineLengths;
+    std::vector<bool> singleLines;
+    std::vector<unsigned int> seeds;
+
+    // Ranges, inclusive, from which random register times, gaps between
+    // arriving batches of customers, and batch sizes are chosen.
+    int minRegisterTime;
+    int maxRegisterTime;
+    int minArrivalGap;
+    int maxArrivalGap;
+    int minBatchSize;
+    int maxBatchSize;
+};
+
+
+
+// How one combination of settings did across all of its runs.
+struct SweepSummary
+{
+    int registerCount;
+    int maxLineLength;
+    bool singleLine;
+
+    int runs;
+    float averageWaitTime;
+    float bestAverageWaitTime;
+    float worstAverageWaitTime;
+    float averageLost;
+    float lostPercentage;
+};
+
+
+
+// readSweepGrid() reads a sweep's grid from a stream, throwing a
+// std::runtime_error describing the problem if it's malformed.
+SweepGrid readSweepGrid(std::istream& in);
+
+
+// runSweep() runs every simulation in the grid, using the given number
+// of threads (or one per core, if it's zero), and returns a summary of
+// each combination of settings, in grid order.
+std::vector<SweepSummary> runSweep(const SweepGrid& grid, unsigned int threadCount = 0);
+
+
+// printSweepSummaries() prints the summaries as a table.
+void printSweepSummaries(std::FILE* out, const std::vector<SweepSummary>& summaries);
+
+
+
+#endif // SWEEP_HPP
@@ -0,0 +1,168 @@
+// TextLog.cpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+
+#include <cstring>
+#include "TextLog.hpp"
+
+
+namespace
+{
+    const char* statsFormat = "STATS\n"
+                              "Entered Line    : %d\n" //# of customers to enter lines
+                              "Exited Line     : %d\n" //# of customers to exit lines
+                              "Exited Register : %d\n" //# of customers to exit registers
+                              "Avg Wait Time   : %.2f\n" //Avg wait time across all customers
+                              "Left In Line    : %d\n" //# of customers still waiting in lines
+                              "Left In Register: %d\n" //# of customers still at registers
+                              "Lost            : %d\n" //# of customers lost
+                              ;
+}
+
+
+TextLog::TextLog(std::FILE* out)
+    : out{out}, used{0}
+{
+}
+
+
+TextLog::~TextLog()
+{
+    flush();
+}
+
+
+void TextLog::start()
+{
+    makeRoom();
+    write("LOG\n0 start\n");
+}
+
+
+void TextLog::enteredLine(int time, unsigned int line, unsigned int length)
+{
+    makeRoom();
+    writeNumber(time);
+    write(" entered line ");
+    writeNumber(line + 1);
+    write(" length ");
+    writeNumber(length);
+    write("\n");
+}
+
+
+void TextLog::exitedLine(int time, unsigned int line, unsigned int length, int timeWaited)
+{
+    makeRoom();
+    writeNumber(time);
+    write(" exited line ");
+    writeNumber(line + 1);
+    write(" length ");
+    writeNumber(length);
+    write(" wait time ");
+    writeNumber(timeWaited);
+    write("\n");
+}
+
+
+void TextLog::enteredRegister(int time, unsigned int reg)
+{
+    makeRoom();
+    writeNumber(time);
+    write(" entered register ");
+    writeNumber(reg + 1);
+    write("\n");
+}
+
+
+void TextLog::exitedRegister(int time, unsigned int reg)
+{
+    makeRoom();
+    writeNumber(time);
+    write(" exited register ");
+    writeNumber(reg + 1);
+    write("\n");
+}
+
+
+void TextLog::lost(int time)
+{
+    makeRoom();
+    writeNumber(time);
+    write(" lost\n");
+}
+
+
+void TextLog::end(int time)
+{
+    makeRoom();
+    writeNumber(time);
+    write(" end\n\n");
+}
+
+
+//The statistics come once per simulation, so there's no need to avoid
+//printf's formatting for them
+void TextLog::stats(const SimulationStats& stats)
+{
+    flush();
+    std::fprintf(out, statsFormat, stats.enteredLine, stats.exitedLine, stats.exitedRegister,
+                 stats.averageWaitTime(), stats.leftInLine, stats.leftInRegister, stats.lost);
+    std::fflush(out);
+}
+
+
+void TextLog::flush()
+{
+    if (used > 0)
+    {
+        std::fwrite(buffer, 1, used, out);
+        used = 0;
+    }
+
+    std::fflush(out);
+}
+
+
+//Writes out the buffer if there might not be room in it for another event
+void TextLog::makeRoom()
+{
+    if (BUFFER_SIZE - used < LONGEST_EVENT)
+    {
+        std::fwrite(buffer, 1, used, out);
+        used = 0;
+    }
+}
+
+
+void TextLog::write(const char* text, unsigned int length)
+{
+    std::memcpy(buffer + used, text, length);
+    used += length;
+}
+
+
+void TextLog::writeNumber(long long number)
+{
+    unsigned long long magnitude = number;
+    if (number < 0)
+    {
+        buffer[used++] = '-';
+        magnitude = 0 - magnitude;
+    }
+
+    //Digits come out last one first, so they're written backward into a
+    //scratch area, then copied
+    char digits[20];
+    unsigned int count = 0;
+
+    do
+    {
+        digits[sizeof(digits) - ++count] = '0' + magnitude % 10;
+        magnitude /= 10;
+    }
+    while (magnitude > 0);
+
+    write(digits + sizeof(digits) - count, count);
+}
@@ -0,0 +1,70 @@
+// TextLog.hpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// A TextLog writes a simulation's log and statistics as text, one event
+// per line, numbering lines and registers from one.
+//
+// Rather than formatting each event with printf and handing it to the
+// C library one line at a time, it formats the numbers itself into a
+// large buffer of its own and writes the buffer out only when it fills
+// up (or when it's flushed or destroyed), so that writing a log with
+// millions of events takes a few hundred writes instead of millions of
+// calls through the C library's formatting and locking.
+
+#ifndef TEXTLOG_HPP
+#define TEXTLOG_HPP
+
+#include <cstdio>
+#include "SimulationLog.hpp"
+
+
+
+class TextLog : public SimulationLog
+{
+public:
+    // Initializes a log that writes to the given file, which it doesn't
+    // own.
+    explicit TextLog(std::FILE* out);
+
+    ~TextLog() override;
+
+    TextLog(const TextLog&) = delete;
+    TextLog& operator=(const TextLog&) = delete;
+
+    void start() override;
+    void enteredLine(int time, unsigned int line, unsigned int length) override;
+    void exitedLine(int time, unsigned int line, unsigned int length, int timeWaited) override;
+    void enteredRegister(int time, unsigned int reg) override;
+    void exitedRegister(int time, unsigned int reg) override;
+    void lost(int time) override;
+    void end(int time) override;
+    void stats(const SimulationStats& stats) override;
+    void flush() override;
+
+private:
+    static constexpr unsigned int BUFFER_SIZE = 1 << 16;
+
+    // The most that any one event's line can take, so that there's always
+    // room for one once the buffer has been made to have this much.
+    static constexpr unsigned int LONGEST_EVENT = 128;
+
+    std::FILE* out;
+    char buffer[BUFFER_SIZE];
+    unsigned int used;
+
+    void makeRoom();
+    void write(const char* text, unsigned int length);
+    void writeNumber(long long number);
+
+    template <unsigned int Length>
+    void write(const char (&text)[Length])
+    {
+        write(text, Length - 1);
+    }
+};
+
+
+
+#endif // TEXTLOG_HPP
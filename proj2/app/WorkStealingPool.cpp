@@ -0,0 +1,176 @@
+// WorkStealingPool.cpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+
+#include <utility>
+#include "WorkStealingPool.hpp"
+
+
+WorkStealingPool::WorkStealingPool(unsigned int threadCount)
+    : nextWorker{0}, queued{0}, unfinished{0}, stopping{false}
+{
+    if (threadCount == 0)
+    {
+        threadCount = std::thread::hardware_concurrency();
+    }
+
+    if (threadCount == 0)
+    {
+        threadCount = 1;
+    }
+
+    for (unsigned int i = 0; i < threadCount; ++i)
+    {
+        workers.push_back(std::make_unique<Worker>());
+    }
+
+    for (unsigned int i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([this, i]() { run(i); });
+    }
+}
+
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::unique_lock<std::mutex> lock{stateMutex};
+        allFinished.wait(lock, [this]() { return unfinished == 0; });
+        stopping = true;
+    }
+
+    taskAvailable.notify_all();
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+
+void WorkStealingPool::submit(std::function<void()> task)
+{
+    Worker& worker = *workers[nextWorker];
+    nextWorker = (nextWorker + 1) % workers.size();
+
+    {
+        std::lock_guard<std::mutex> lock{worker.mutex};
+        worker.tasks.push_back(std::move(task));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{stateMutex};
+        ++queued;
+        ++unfinished;
+    }
+
+    taskAvailable.notify_one();
+}
+
+
+void WorkStealingPool::wait()
+{
+    std::unique_lock<std::mutex> lock{stateMutex};
+    allFinished.wait(lock, [this]() { return unfinished == 0; });
+
+    if (firstFailure)
+    {
+        std::exception_ptr failure = firstFailure;
+        firstFailure = nullptr;
+        std::rethrow_exception(failure);
+    }
+}
+
+
+unsigned int WorkStealingPool::threadCount() const noexcept
+{
+    return threads.size();
+}
+
+
+//The loop each worker thread runs: claim one of the queued tasks, find
+//it (in its own deque or someone else's), run it, repeat
+void WorkStealingPool::run(unsigned int self)
+{
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock{stateMutex};
+            taskAvailable.wait(lock, [this]() { return stopping || queued > 0; });
+
+            if (queued == 0)
+            {
+                return;
+            }
+
+            --queued;
+        }
+
+        //Every worker that gets here has claimed a task that's still in
+        //some deque, so the search always finds one eventually, though
+        //another worker may take the one it saw first
+        std::function<void()> task;
+        while (!takeTask(self, task))
+        {
+            std::this_thread::yield();
+        }
+
+        std::exception_ptr failure;
+        try
+        {
+            task();
+        }
+        catch (...)
+        {
+            failure = std::current_exception();
+        }
+
+        bool done;
+        {
+            std::lock_guard<std::mutex> lock{stateMutex};
+            if (failure && !firstFailure)
+            {
+                firstFailure = failure;
+            }
+
+            done = --unfinished == 0;
+        }
+
+        if (done)
+        {
+            allFinished.notify_all();
+        }
+    }
+}
+
+
+//Takes the newest task from the worker's own deque or, if that's empty,
+//steals the oldest one from the first other worker that has any
+bool WorkStealingPool::takeTask(unsigned int self, std::function<void()>& task)
+{
+    {
+        Worker& own = *workers[self];
+        std::lock_guard<std::mutex> lock{own.mutex};
+        if (!own.tasks.empty())
+        {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+
+    for (unsigned int i = 1; i < workers.size(); ++i)
+    {
+        Worker& victim = *workers[(self + i) % workers.size()];
+        std::lock_guard<std::mutex> lock{victim.mutex};
+        if (!victim.tasks.empty())
+        {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,81 @@
+// WorkStealingPool.hpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// A WorkStealingPool runs tasks on a fixed set of worker threads.  Each
+// worker has its own deque of tasks, and submitted tasks are dealt out
+// to the workers in turn.  A worker takes tasks from the back of its own
+// deque; once that's empty, it steals from the front of another's, so
+// workers that are dealt quick tasks help out the ones that were dealt
+// slow ones, rather than sitting idle while they finish.
+//
+// Each deque has its own mutex, so workers taking their own tasks don't
+// contend with one another; a shared mutex is held only long enough to
+// count tasks and to put idle workers to sleep.
+
+#ifndef WORKSTEALINGPOOL_HPP
+#define WORKSTEALINGPOOL_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+
+class WorkStealingPool
+{
+public:
+    // Starts the given number of worker threads, or one per core if it's
+    // zero.
+    explicit WorkStealingPool(unsigned int threadCount = 0);
+
+    // Waits for every submitted task to finish, then stops the workers.
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    // submit() hands a task to the pool, to be run on one of its workers.
+    void submit(std::function<void()> task);
+
+    // wait() blocks until every task submitted so far has finished.  If
+    // any of them threw an exception, the first one is rethrown here.
+    void wait();
+
+    // threadCount() returns how many worker threads the pool has.
+    unsigned int threadCount() const noexcept;
+
+private:
+    struct Worker
+    {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+    unsigned int nextWorker;
+
+    // Guards the counts below, which let idle workers sleep until there's
+    // something to take, and let wait() sleep until everything is done.
+    std::mutex stateMutex;
+    std::condition_variable taskAvailable;
+    std::condition_variable allFinished;
+    unsigned int queued;
+    unsigned int unfinished;
+    bool stopping;
+    std::exception_ptr firstFailure;
+
+    void run(unsigned int self);
+    bool takeTask(unsigned int self, std::function<void()>& task);
+};
+
+
+
+#endif // WORKSTEALINGPOOL_HPP
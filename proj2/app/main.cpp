@@ -10,301 +10,171 @@
 // be in the "app" directory, though, naturally, it shouldn't all be in
 // this file.  A design that keeps separate things separate is always
 // part of the requirements.
+//
+// Run without arguments, it reads one simulation's settings and arrivals
+// from the standard input, then prints its log and statistics.  Other
+// ways to run it are:
+//
+//     simulation --log text|binary|none
+//
+// which runs one simulation the same way, but writes its log as text
+// (the default), as a binary log (see BinaryLog.hpp), or not at all,
+// printing only its statistics;
+//
+//     simulation --decode
+//
+// which reads a binary log from the standard input and prints it as
+// text, exactly as the simulation would have; and
+//
+//     simulation --sweep [threads]
+//
+// which reads a sweep's grid (see Sweep.hpp) from the standard input,
+// runs every simulation in it, and prints a summary table.
 
-#include <string>
-#include <vector>
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
-#include <queue>
-#include "Queue.hpp"
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include "BinaryLog.hpp"
+#include "InputScanner.hpp"
+#include "Simulation.hpp"
+#include "Sweep.hpp"
+#include "TextLog.hpp"
 
-//Customer
-struct Customer {
-    int timeEnteredLine;
-};
 
-//Returns an index of a line where maximum space is available, otherwise returns -1
-int isEmptyLine(std::vector<Queue<Customer>>& lines, int maxLineLength) {
-    int minCustomers = INT_MAX;
-    int index = -1;
-    for (int i = 0; i < lines.size(); ++i) {
-        int customersInLine = lines.at(i).size();
-        if (customersInLine != maxLineLength && customersInLine < minCustomers) {
-            minCustomers = customersInLine;
-            index = i;
+namespace
+{
+    int simulateOnce(const std::string& logMode)
+    {
+        std::unique_ptr<SimulationLog> log;
+        if (logMode == "text")
+        {
+            log = std::make_unique<TextLog>(stdout);
         }
-    }
-    return index;
-}
-
-//Updates register and associated line for time in between customers entering lines
-void updateTimeBetweenCustomers(std::vector<std::pair<bool, int>>& registerAvailability, std::vector<Queue<Customer>>& lineStorage,
-                                std::vector<int>& registerWaitTimes, int& time, int& customerTime,
-                                int& customersExitedLine, int& customersExitedRegister,
-                                int& totalTimeWaited, const char* exitedLineString, const char* exitedRegisterString,
-                                const char* enteredRegisterString) {
-    //Priority queue lambda compare function (first is register index, second is time remaining)
-    auto compare = [](std::pair<int, int> left, std::pair<int, int> right) {
-        if (left.second < right.second) {
-            return false;
-        } else if (left.second > right.second) {
-            return true;
-        } else {
-            return left.first >= right.first;
+        else if (logMode == "binary")
+        {
+            log = std::make_unique<BinaryLog>(stdout);
         }
-    };
-
-
-    //Priority queue for making sure older times are logged first
-    std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, decltype(compare)> priorityQueue(compare);
-
-    for (int i = 0; i < registerAvailability.size(); ++i) {
-        //Check if anyone at register
-        if (!registerAvailability.at(i).first) {
-            continue;
+        else if (logMode != "none")
+        {
+            std::fprintf(stderr, "unknown log mode '%s'\n", logMode.c_str());
+            return 1;
         }
 
-        //Calculate time left for customer at register
-        int timeRemaining = (registerAvailability.at(i).second - customerTime) + registerWaitTimes.at(i);
-
-        //Check if customer is about to leave register as new customer comes in
-        if (timeRemaining == 0) {
-            registerAvailability.at(i).second = 0;
-            continue;
+        //Read the simulation's settings
+        SimulationSettings settings;
+        int numRegisters = 0;
+        std::string lineSetup;
+
+        InputScanner input{stdin};
+        if (!input.nextInt(settings.length) || !input.nextInt(numRegisters)
+            || !input.nextInt(settings.maxLineLength) || !input.nextWord(lineSetup))
+        {
+            std::fprintf(stderr, "missing or malformed simulation settings\n");
+            return 1;
         }
 
-        priorityQueue.push(std::make_pair(i, timeRemaining));
-
-    }
-
-    while (!priorityQueue.empty()) {
-
-        int i = priorityQueue.top().first;
-        int timeRemaining = priorityQueue.top().second;
-        priorityQueue.pop();
-        
-        //Update registers and lines while still in negative time
-        while (timeRemaining < 0) {
-
-            //Log customer leaving register
-            printf(exitedRegisterString, timeRemaining + customerTime, i + 1);
-            customersExitedRegister++;
-
-            //Remove customer from register
-            registerAvailability.at(i).first = false;
-            registerAvailability.at(i).second = 0;
-
-            //Check if line is empty (if it is and timeRemaining is still negative then set to false)
-            if (lineStorage.at(i).isEmpty() && timeRemaining < 0) {
-                break;
-            } else {
-
-                //Store customer info and remove from line
-                int timeEnteredRegister = timeRemaining + customerTime;
-                int timeEnteredLine = lineStorage.at(i).front().timeEnteredLine;
-                lineStorage.at(i).dequeue();
-
-                //Log customer exiting the line
-                printf(exitedLineString, timeEnteredRegister, i + 1, lineStorage.at(i).size(), timeEnteredRegister - timeEnteredLine);
-                customersExitedLine++;
-
-                //Add customer to register
-                registerAvailability.at(i).first = true;
-                registerAvailability.at(i).second = timeEnteredRegister;
-
-                //Log customer entering register
-                totalTimeWaited += timeEnteredRegister - timeEnteredLine;
-                printf(enteredRegisterString, timeEnteredRegister, i + 1);
-                timeRemaining = (registerAvailability.at(i).second - customerTime) + registerWaitTimes.at(i);
+        settings.length = settings.length * 60; //Set sim length to seconds instead of minutes
+        settings.singleLine = lineSetup == "S";
+        settings.log = log.get();
+
+        for (int i = 0; i < numRegisters; ++i)
+        {
+            int registerTime = 0;
+            if (!input.nextInt(registerTime))
+            {
+                std::fprintf(stderr, "missing or malformed time for register %d\n", i + 1);
+                return 1;
             }
-        }
-    }
-}
-
-int main()
-{
-    // =================================================================================================================
-    //VARIABLES
-    //InputVars
-    int simLength;
-    int numRegisters;
-    int maxLineLength;
-    bool isSingleLine = false;
-
-    //SimVars
-    int customersEnteredLine = 0;
-    int customersLost = 0;
-
-    int customersExitedLine = 0;
-    int customersExitedRegister = 0;
-
-    int customersRemainingLine = 0;
-    int customersRemainingRegister = 0;
-
-    int time = 0;
-    int totalTimeWaited = 0;
-    // =================================================================================================================
-    //SIMULATION REPRESENTATIONS
-    std::vector<Queue<Customer>> lineStorage; //Stores the queues that represent the lines
-    std::vector<int> registerWaitTimes; //Stores the register wait times
-    std::vector<std::pair<bool, int>> registerAvailablity; //Stores if someone at register and the times at which customers entered the registers
-    // =================================================================================================================
-    //STRING TEMPLATES
-    const char *enteredLine = "%d entered line %d length %d\n"; //Time, Line #, Length
-    const char *exitedLine = "%d exited line %d length %d wait time %d\n"; //Time, Line #, Length, Wait Time
-    const char *enteredRegister = "%d entered register %d\n"; //Time, Register #
-    const char *exitedRegister = "%d exited register %d\n"; //Time, Register #
-    const char *lostCustomer = "%d lost\n"; //Time
 
-    const char *stats = "STATS\n"
-                        "Entered Line    : %d\n" //# of customers to enter lines
-                        "Exited Line     : %d\n" //# of customers to exit lines
-                        "Exited Register : %d\n" //# of customers to exit registers
-                        "Avg Wait Time   : %.2f\n" //Avg wait time across all customers
-                        "Left In Line    : %d\n" //# of customers still waiting in lines
-                        "Left In Register: %d\n" //# of customers still at registers
-                        "Lost            : %d\n" //# of customers lost
-                        ;
-    // =================================================================================================================
-    //SIMULATION
-
-    std::cin >> simLength >> numRegisters >> maxLineLength;
-    simLength = simLength * 60; //Set sim length to seconds instead of minutes
-    std::string tempSingleLine;
-    std::cin >> tempSingleLine;
-    if (tempSingleLine == "S") {isSingleLine = true;}
-
-    //Add wait times to registerWaitTimes
-    for (int i = 0; i < numRegisters; ++i) {
-        int tempWaitTime;
-        std::cin >> tempWaitTime;
-        registerWaitTimes.push_back(tempWaitTime);
-        registerAvailablity.emplace_back(false, 0);
-    }
-
-    //Create queues for lines
-    if (isSingleLine) {
-        lineStorage.emplace_back();
-    } else {
-        for (int i = 0; i < numRegisters; ++i) {
-            lineStorage.emplace_back();
+            settings.registerTimes.push_back(registerTime);
         }
-    }
 
-    //Simulation loop
-    std::cout << "LOG\n0 start" << std::endl;
+        //Run the simulation, one batch of arriving customers at a time
+        Simulation simulation{settings};
+        simulation.start();
 
-    int customerAmount;
-    int customerTime;
-    while (std::cin >> customerAmount) {
-        std::cin >> customerTime;
-
-        //Update all registers and time for the time in between last customers and new customers
-        updateTimeBetweenCustomers(registerAvailablity, lineStorage, registerWaitTimes, time, customerTime,
-                                customersExitedLine, customersExitedRegister, totalTimeWaited, exitedLine,
-                                exitedRegister, enteredRegister);
-
-        time = customerTime;
-
-        //Enter customers into line
-        for (int i = 0; i < customerAmount; ++i) {
-
-            //Check if all lines are full
-            int index = isEmptyLine(lineStorage, maxLineLength);
-            if (index < 0) {
-                customersLost++;
-                printf(lostCustomer, time);
-            } else {
-                lineStorage.at(index).enqueue(Customer{time});
-                customersEnteredLine++;
-                printf(enteredLine, time, index + 1, lineStorage.at(index).size());
-            }
+        int customerAmount;
+        int customerTime;
+        while (input.nextInt(customerAmount) && input.nextInt(customerTime))
+        {
+            simulation.addCustomers(customerAmount, customerTime);
         }
 
-        //Enter customers into register
-        for (int i = 0; i < lineStorage.size(); ++i) {
-
-            //Check if someone is at the register
-            if (!registerAvailablity.at(i).first && !lineStorage.at(i).isEmpty()) { //No one is at the register and no one in line
-
-                //Add customer in line to register
-                registerAvailablity.at(i).first = true;
-                registerAvailablity.at(i).second = time;
-
-                //Calculate timeWaited
-                int timeWaited = time - lineStorage.at(i).front().timeEnteredLine;
-
-                //Remove customer from line
-                lineStorage.at(i).dequeue();
-
-                //Log customer leaving line
-                printf(exitedLine, time, i + 1, lineStorage.at(i).size(), timeWaited);
-                customersExitedLine++;
-                totalTimeWaited += timeWaited;
-
-                //Log customer entering register
-                printf(enteredRegister, time, i + 1);
-            } else { //Someone is at the register
-
-                //Check if customer at register was about to leave
-                if (registerAvailablity.at(i).first && registerAvailablity.at(i).second == 0) {
-
-                    //Log customer leaving register
-                    printf(exitedRegister, time, i + 1);
-                    customersExitedRegister++;
-
-                    //Remove customer from register
-                    registerAvailablity.at(i).first = false;
-                    registerAvailablity.at(i).second = 0;
+        SimulationStats stats = simulation.finish();
 
-                    //Check if there are any customers in line
-                    if (!lineStorage.at(i).isEmpty()) {
-
-                        //Add customer in line to register
-                        registerAvailablity.at(i).first = true;
-                        registerAvailablity.at(i).second = time;
-
-                        //Calculate timeWaited
-                        int timeWaited = time - lineStorage.at(i).front().timeEnteredLine;
+        if (log != nullptr)
+        {
+            log->stats(stats);
+        }
+        else
+        {
+            TextLog{stdout}.stats(stats);
+        }
 
-                        //Remove customer from line
-                        lineStorage.at(i).dequeue();
+        return 0;
+    }
 
-                        //Log customer leaving line
-                        printf(exitedLine, time, i + 1, lineStorage.at(i).size(), timeWaited);
-                        customersExitedLine++;
-                        totalTimeWaited += timeWaited;
 
-                        //Log customer entering register
-                        printf(enteredRegister, time, i + 1);
-                    }
-                }
-            }
+    int simulateSweep(unsigned int threadCount)
+    {
+        try
+        {
+            SweepGrid grid = readSweepGrid(std::cin);
+            printSweepSummaries(stdout, runSweep(grid, threadCount));
+            return 0;
+        }
+        catch (const std::runtime_error& e)
+        {
+            std::fprintf(stderr, "%s\n", e.what());
+            return 1;
         }
     }
 
-    //Cleanup (deal with remaining customers up until simLength is reached)
-    //Update all registers and time for the time in between last customers and end of simulation
-    updateTimeBetweenCustomers(registerAvailablity, lineStorage, registerWaitTimes, time, simLength,
-                               customersExitedLine, customersExitedRegister, totalTimeWaited, exitedLine,
-                               exitedRegister, enteredRegister);
-
-    std::cout << simLength << " end\n" << std::endl;
-
-    //STATS
-    float avgWaitTime;
 
-    avgWaitTime = (float)totalTimeWaited / (float)customersExitedLine;
-    for (int i = 0; i < registerAvailablity.size(); ++i) {
-        if (registerAvailablity.at(i).first) {
-            customersRemainingRegister++;
+    int decode()
+    {
+        try
+        {
+            TextLog log{stdout};
+            decodeBinaryLog(stdin, log);
+            return 0;
+        }
+        catch (const std::runtime_error& e)
+        {
+            std::fprintf(stderr, "%s\n", e.what());
+            return 1;
         }
-        customersRemainingLine += lineStorage.at(i).size();
     }
+}
 
-    printf(stats, customersEnteredLine, customersExitedLine, customersExitedRegister, avgWaitTime,
-            customersRemainingLine, customersRemainingRegister, customersLost);
 
+int main(int argc, char** argv)
+{
+    std::string mode = argc > 1 ? argv[1] : "";
 
-    return 0;
+    if (mode == "--sweep")
+    {
+        unsigned int threadCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 0;
+        return simulateSweep(threadCount);
+    }
+    else if (mode == "--decode")
+    {
+        return decode();
+    }
+    else if (mode == "--log" && argc > 2)
+    {
+        return simulateOnce(argv[2]);
+    }
+    else if (mode == "")
+    {
+        return simulateOnce("text");
+    }
+    else
+    {
+        std::fprintf(stderr, "usage: %s [--log text|binary|none | --decode | --sweep [threads]]\n", argv[0]);
+        return 1;
+    }
 }
-
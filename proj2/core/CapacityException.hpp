@@ -0,0 +1,20 @@
+// CapacityException.hpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// An exception that is thrown when a WorkQueue is asked to hold no
+// values at all, since nothing could ever be enqueued into it.
+
+#ifndef CAPACITYEXCEPTION_HPP
+#define CAPACITYEXCEPTION_HPP
+
+
+
+class CapacityException
+{
+};
+
+
+
+#endif
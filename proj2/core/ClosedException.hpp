@@ -0,0 +1,20 @@
+// ClosedException.hpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// An exception that is thrown when a value is added to a WorkQueue
+// that has already been closed.
+
+#ifndef CLOSEDEXCEPTION_HPP
+#define CLOSEDEXCEPTION_HPP
+
+
+
+class ClosedException
+{
+};
+
+
+
+#endif
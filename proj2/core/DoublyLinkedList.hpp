@@ -95,11 +95,23 @@ public:
     // it will now be the first value, with all subsequent elements still
     // being in the list (after the new value) in the same order.
     void addToStart(const ValueType& value);
+    void addToStart(ValueType&& value);
 
     // addToEnd() adds a value to the end of the list, meaning that
     // it will now be the last value, with all subsequent elements still
     // being in the list (before the new value) in the same order.
     void addToEnd(const ValueType& value);
+    void addToEnd(ValueType&& value);
+
+    // emplaceFront() and emplaceBack() are like addToStart() and
+    // addToEnd(), except that rather than copying or moving an existing
+    // value into the list, they construct a new one in place, passing
+    // the given arguments to its constructor.
+    template <typename... Args>
+    void emplaceFront(Args&&... args);
+
+    template <typename... Args>
+    void emplaceBack(Args&&... args);
 
 
     // removeFromStart() removes a value from the start of the list, meaning
@@ -140,6 +152,56 @@ public:
     unsigned int size() const noexcept;
 
 
+    // splice() moves every value out of the given list and into this
+    // one, in order, just before the value that the given Iterator over
+    // this list refers to (or at the end, if it isn't referring to a
+    // value), leaving the given list empty.  The values aren't copied;
+    // their nodes are relinked, so this takes O(1) time no matter how
+    // many there are.  The given Iterator goes on referring to the same
+    // value, but other iterators over either list shouldn't be used
+    // afterward.  If the Iterator is over some other list, an
+    // IteratorException is thrown.
+    void splice(Iterator& position, DoublyLinkedList& list);
+
+    // splitAt() removes the value that the given Iterator over this list
+    // refers to, along with every value after it, and returns them, in
+    // order, as a new list.  (If the Iterator isn't referring to a value,
+    // nothing is removed and the new list is empty.)  The Iterator is
+    // left "past end" of this list, and other iterators over it
+    // shouldn't be used afterward.  Relinking the nodes takes O(1) time;
+    // working out how many of them go with each list takes time
+    // proportional to the smaller of the two.  If the Iterator is over
+    // some other list, an IteratorException is thrown.
+    DoublyLinkedList splitAt(Iterator& position);
+
+    // merge() moves every value out of the given list and into this one,
+    // leaving the given list empty.  Both lists must already be sorted;
+    // the values are interleaved so that this list remains sorted, with
+    // equal values from this list coming before those from the given
+    // one.  No values are copied, and it takes time proportional to the
+    // total number of values.  Values are compared with < unless a
+    // function that compares them is given.  If a comparison throws an
+    // exception, all of the values will be in this list, though not
+    // necessarily in order.
+    void merge(DoublyLinkedList& list);
+
+    template <typename LessThan>
+    void merge(DoublyLinkedList& list, LessThan lessThan);
+
+    // sort() puts the values in the list in order, keeping equal values
+    // in the order they were already in.  It's a merge sort that
+    // relinks the list's nodes rather than moving any values, so it
+    // takes O(n log n) time and allocates no memory.  Values are
+    // compared with < unless a function that compares them is given.
+    // Existing iterators over the list shouldn't be used afterward.  If
+    // a comparison throws an exception, all of the values will still be
+    // in the list, though not necessarily in order.
+    void sort();
+
+    template <typename LessThan>
+    void sort(LessThan lessThan);
+
+
 
     // There are two kinds of iterators supported: Iterators and
     // ConstIterators.  They have similar characteristics; they both
@@ -269,6 +331,7 @@ public:
         // iterator is in the "past start" position, an IteratorException
         // is thrown.
         void insertBefore(const ValueType& value);
+        void insertBefore(ValueType&& value);
 
 
         // insertAfter() inserts a new value into the list after
@@ -276,6 +339,18 @@ public:
         // iterator is in the "past end" position, an IteratorException
         // is thrown.
         void insertAfter(const ValueType& value);
+        void insertAfter(ValueType&& value);
+
+
+        // emplaceBefore() and emplaceAfter() are like insertBefore() and
+        // insertAfter(), except that rather than copying or moving an
+        // existing value into the list, they construct a new one in
+        // place, passing the given arguments to its constructor.
+        template <typename... Args>
+        void emplaceBefore(Args&&... args);
+
+        template <typename... Args>
+        void emplaceAfter(Args&&... args);
 
 
         // remove() removes the value to which this iterator refers,
@@ -289,6 +364,8 @@ public:
     private:
         DoublyLinkedList& baseList;
         // You may want private member variables and member functions.
+
+        friend class DoublyLinkedList;
     };
 
 
@@ -298,16 +375,58 @@ private:
     // to the previous node (or nullptr if there isn't one) and
     // one pointing to the next node (or nullptr if there isn't
     // one).
+    //
+    // Nodes are constructed in place, in storage that the list manages
+    // itself (see NodeSlot below), which is what the placement form of
+    // operator new is for.
     struct Node
     {
         ValueType value;
         Node* prev;
         Node* next;
+
+        template <typename... Args>
+        Node(Node* prev, Node* next, Args&&... args);
+
+        static void* operator new(decltype(sizeof(0)), void* place) noexcept;
+        static void operator delete(void*, void*) noexcept;
+    };
+
+    // The storage for one Node.  When a node is removed, its value is
+    // destroyed, but its storage is kept on a list of spare slots, to be
+    // used by the next node that's added, so a list whose size stays
+    // about the same (like a queue in steady state) doesn't allocate or
+    // deallocate memory at all.  The spare slots are only given back
+    // when the list is destroyed.
+    union NodeSlot
+    {
+        NodeSlot* nextSpare;
+        alignas(Node) unsigned char storage[sizeof(Node)];
     };
 
     Node * firstNode;
     Node * lastNode;
     unsigned int listSize;
+    NodeSlot * spareSlots;
+
+    template <typename... Args>
+    Node * createNode(Node* prev, Node* next, Args&&... args);
+    void destroyNode(Node* node) noexcept;
+    void releaseSpareSlots() noexcept;
+
+    // A run of nodes linked only through their next pointers, which is
+    // all that sorting and merging need until they're finished.
+    struct Chain
+    {
+        Node * first;
+        Node * last;
+    };
+
+    template <typename LessThan>
+    static void mergeChains(Chain& chain, Chain& other, LessThan& lessThan);
+    static void appendChain(Chain& chain, Chain& other) noexcept;
+    static Chain takeFirst(Chain& chain) noexcept;
+    void adoptChain(const Chain& chain, unsigned int size) noexcept;
 
     // You can feel free to add private member variables and member
     // functions here; there's a pretty good chance you'll need some.
@@ -321,6 +440,7 @@ DoublyLinkedList<ValueType>::DoublyLinkedList() noexcept
     firstNode = nullptr;
     lastNode = nullptr;
     listSize = 0;
+    spareSlots = nullptr;
 }
 
 
@@ -330,6 +450,7 @@ DoublyLinkedList<ValueType>::DoublyLinkedList(const DoublyLinkedList& list)
     firstNode = nullptr;
     lastNode = nullptr;
     listSize = 0;
+    spareSlots = nullptr;
 
     //Check if list being copied from is empty
     if (list.size() == 0) {
@@ -358,6 +479,8 @@ DoublyLinkedList<ValueType>::DoublyLinkedList(DoublyLinkedList&& list) noexcept
     list.lastNode = nullptr;
     listSize = list.listSize;
     list.listSize = 0;
+    spareSlots = list.spareSlots;
+    list.spareSlots = nullptr;
 }
 
 
@@ -367,22 +490,23 @@ DoublyLinkedList<ValueType>::~DoublyLinkedList() noexcept
     Node * temp = firstNode;
     while (temp != nullptr) {
         Node * nextTempNode = temp->next;
-        delete temp;
+        destroyNode(temp);
         temp = nextTempNode;
     }
     firstNode = nullptr;
     lastNode = nullptr;
+    releaseSpareSlots();
 }
 
 
 template <typename ValueType>
 DoublyLinkedList<ValueType>& DoublyLinkedList<ValueType>::operator=(const DoublyLinkedList& list)
 {
-    //Delete current linked list
+    //Delete current linked list (its slots are reused for the copy)
     Node * temp = firstNode;
     while (temp != nullptr) {
         Node * nextTempNode = temp->next;
-        delete temp;
+        destroyNode(temp);
         temp = nextTempNode;
     }
     firstNode = nullptr;
@@ -430,29 +554,42 @@ DoublyLinkedList<ValueType>& DoublyLinkedList<ValueType>::operator=(DoublyLinked
     listSize = list.listSize;
     list.listSize = tempSize;
 
+    NodeSlot * tempSlots = spareSlots;
+    spareSlots = list.spareSlots;
+    list.spareSlots = tempSlots;
+
     return *this;
 }
 
 
 template <typename ValueType>
 void DoublyLinkedList<ValueType>::addToStart(const ValueType& value)
+{
+    emplaceFront(value);
+}
+
+
+template <typename ValueType>
+void DoublyLinkedList<ValueType>::addToStart(ValueType&& value)
+{
+    emplaceFront(static_cast<ValueType&&>(value));
+}
+
+
+template <typename ValueType>
+template <typename... Args>
+void DoublyLinkedList<ValueType>::emplaceFront(Args&&... args)
 {
     if (firstNode == nullptr) {
         //Create new node pointing to nullptrs
-        Node * newNode = new Node;
-        newNode->value = value;
-        newNode->prev = nullptr;
-        newNode->next = nullptr;
+        Node * newNode = createNode(nullptr, nullptr, static_cast<Args&&>(args)...);
 
         //Set first and last node to new node
         firstNode = newNode;
         lastNode = newNode;
     } else {
         //Create new node with correct pointers
-        Node * newNode = new Node;
-        newNode->value = value;
-        newNode->next = firstNode;
-        newNode->prev = nullptr;
+        Node * newNode = createNode(nullptr, firstNode, static_cast<Args&&>(args)...);
 
         //Set previous firstNode->next to newNode
         firstNode->prev = newNode;
@@ -465,23 +602,32 @@ void DoublyLinkedList<ValueType>::addToStart(const ValueType& value)
 
 template <typename ValueType>
 void DoublyLinkedList<ValueType>::addToEnd(const ValueType& value)
+{
+    emplaceBack(value);
+}
+
+
+template <typename ValueType>
+void DoublyLinkedList<ValueType>::addToEnd(ValueType&& value)
+{
+    emplaceBack(static_cast<ValueType&&>(value));
+}
+
+
+template <typename ValueType>
+template <typename... Args>
+void DoublyLinkedList<ValueType>::emplaceBack(Args&&... args)
 {
     if (firstNode == nullptr) {
         //Create new node pointing to nullptrs
-        Node * temp = new Node;
-        temp->value = value;
-        temp->prev = nullptr;
-        temp->next = nullptr;
+        Node * temp = createNode(nullptr, nullptr, static_cast<Args&&>(args)...);
 
         //Set first and last node to new node
         firstNode = temp;
         lastNode = temp;
     } else {
         //Create new node with correct pointers
-        Node * newNode = new Node;
-        newNode->value = value;
-        newNode->next = nullptr;
-        newNode->prev = lastNode;
+        Node * newNode = createNode(lastNode, nullptr, static_cast<Args&&>(args)...);
 
         //Set previous lastNode->next to newNode
         lastNode->next = newNode;
@@ -498,14 +644,14 @@ void DoublyLinkedList<ValueType>::removeFromStart()
     if (firstNode == nullptr) {
         throw EmptyException();
     } else if (listSize == 1) {
-        delete firstNode;
+        destroyNode(firstNode);
         firstNode = nullptr;
         lastNode = nullptr;
     } else {
         Node * temp = firstNode;
         firstNode = firstNode->next;
         firstNode->prev = nullptr;
-        delete temp;
+        destroyNode(temp);
     }
     listSize--;
 }
@@ -517,19 +663,207 @@ void DoublyLinkedList<ValueType>::removeFromEnd()
     if (firstNode == nullptr) {
         throw EmptyException();
     } else if (listSize == 1) {
-        delete lastNode;
+        destroyNode(lastNode);
         firstNode = nullptr;
         lastNode = nullptr;
     } else {
         Node * temp = lastNode;
         lastNode = lastNode->prev;
         lastNode->next = nullptr;
-        delete temp;
+        destroyNode(temp);
     }
     listSize--;
 }
 
 
+template <typename ValueType>
+void DoublyLinkedList<ValueType>::splice(Iterator& position, DoublyLinkedList& list)
+{
+    if (&position.baseList != this) {
+        throw IteratorException();
+    }
+
+    if (&list == this || list.listSize == 0) {
+        return;
+    }
+
+    Node * before = position.currentNode;
+
+    if (before == nullptr) { //Add to the end
+        list.firstNode->prev = lastNode;
+        if (lastNode != nullptr) {
+            lastNode->next = list.firstNode;
+        } else {
+            firstNode = list.firstNode;
+        }
+        lastNode = list.lastNode;
+    } else { //Add before the iterator's node
+        list.firstNode->prev = before->prev;
+        list.lastNode->next = before;
+        if (before->prev != nullptr) {
+            before->prev->next = list.firstNode;
+        } else {
+            firstNode = list.firstNode;
+        }
+        before->prev = list.lastNode;
+    }
+    listSize += list.listSize;
+
+    //The given list keeps its spare slots, but none of its nodes
+    list.firstNode = nullptr;
+    list.lastNode = nullptr;
+    list.listSize = 0;
+
+    position.itrFirstNode = firstNode;
+    position.itrLastNode = lastNode;
+    position.itrListSize = listSize;
+}
+
+
+template <typename ValueType>
+DoublyLinkedList<ValueType> DoublyLinkedList<ValueType>::splitAt(Iterator& position)
+{
+    if (&position.baseList != this) {
+        throw IteratorException();
+    }
+
+    DoublyLinkedList rest;
+    Node * splitNode = position.currentNode;
+    if (splitNode == nullptr) {
+        return rest;
+    }
+
+    //Walk outward from the split in both directions at once; whichever
+    //end is reached first says how big that part is, and so the other
+    unsigned int restSize;
+    Node * forward = splitNode;
+    Node * backward = splitNode->prev;
+    for (unsigned int steps = 0; ; ++steps) {
+        if (forward == nullptr) {
+            restSize = steps;
+            break;
+        } else if (backward == nullptr) {
+            restSize = listSize - steps;
+            break;
+        }
+        forward = forward->next;
+        backward = backward->prev;
+    }
+
+    rest.firstNode = splitNode;
+    rest.lastNode = lastNode;
+    rest.listSize = restSize;
+
+    lastNode = splitNode->prev;
+    if (lastNode != nullptr) {
+        lastNode->next = nullptr;
+    } else {
+        firstNode = nullptr;
+    }
+    splitNode->prev = nullptr;
+    listSize -= restSize;
+
+    position.currentNode = nullptr;
+    position.itrFirstNode = firstNode;
+    position.itrLastNode = lastNode;
+    position.itrListSize = listSize;
+
+    return rest;
+}
+
+
+template <typename ValueType>
+void DoublyLinkedList<ValueType>::merge(DoublyLinkedList& list)
+{
+    merge(list, [](const ValueType& a, const ValueType& b) { return a < b; });
+}
+
+
+template <typename ValueType>
+template <typename LessThan>
+void DoublyLinkedList<ValueType>::merge(DoublyLinkedList& list, LessThan lessThan)
+{
+    if (&list == this) {
+        return;
+    }
+
+    Chain chain{firstNode, lastNode};
+    Chain other{list.firstNode, list.lastNode};
+    unsigned int totalSize = listSize + list.listSize;
+
+    list.firstNode = nullptr;
+    list.lastNode = nullptr;
+    list.listSize = 0;
+
+    try {
+        mergeChains(chain, other, lessThan);
+    } catch (...) {
+        adoptChain(chain, totalSize);
+        throw;
+    }
+
+    adoptChain(chain, totalSize);
+}
+
+
+template <typename ValueType>
+void DoublyLinkedList<ValueType>::sort()
+{
+    sort([](const ValueType& a, const ValueType& b) { return a < b; });
+}
+
+
+template <typename ValueType>
+template <typename LessThan>
+void DoublyLinkedList<ValueType>::sort(LessThan lessThan)
+{
+    //A bottom-up merge sort: each node is merged into a carried run that
+    //ripples up through the bins, where bins[i] is either empty or holds
+    //a sorted run of 2^i nodes, all of which came before those in lower
+    //bins.  Merging older runs first keeps the sort stable.
+    constexpr unsigned int binCount = sizeof(unsigned int) * 8 + 1;
+    Chain bins[binCount] = {};
+    Chain carry{nullptr, nullptr};
+    Chain unsorted{firstNode, lastNode};
+
+    try {
+        while (unsorted.first != nullptr) {
+            carry = takeFirst(unsorted);
+
+            unsigned int i = 0;
+            for (; bins[i].first != nullptr; ++i) {
+                mergeChains(bins[i], carry, lessThan);
+                carry = bins[i];
+                bins[i] = Chain{nullptr, nullptr};
+            }
+            bins[i] = carry;
+            carry = Chain{nullptr, nullptr};
+        }
+
+        Chain sorted{nullptr, nullptr};
+        for (unsigned int i = 0; i < binCount; ++i) {
+            mergeChains(bins[i], sorted, lessThan);
+            sorted = bins[i];
+            bins[i] = Chain{nullptr, nullptr};
+        }
+
+        adoptChain(sorted, listSize);
+    } catch (...) {
+        //Every node is still in exactly one of the chains, so they're put
+        //back together, out of order, before the exception goes on
+        Chain everything{nullptr, nullptr};
+        for (unsigned int i = 0; i < binCount; ++i) {
+            appendChain(everything, bins[i]);
+        }
+        appendChain(everything, carry);
+        appendChain(everything, unsorted);
+
+        adoptChain(everything, listSize);
+        throw;
+    }
+}
+
+
 template <typename ValueType>
 const ValueType& DoublyLinkedList<ValueType>::first() const
 {
@@ -721,25 +1055,34 @@ ValueType& DoublyLinkedList<ValueType>::Iterator::value() const
 
 template <typename ValueType>
 void DoublyLinkedList<ValueType>::Iterator::insertBefore(const ValueType& value)
+{
+    emplaceBefore(value);
+}
+
+
+template <typename ValueType>
+void DoublyLinkedList<ValueType>::Iterator::insertBefore(ValueType&& value)
+{
+    emplaceBefore(static_cast<ValueType&&>(value));
+}
+
+
+template <typename ValueType>
+template <typename... Args>
+void DoublyLinkedList<ValueType>::Iterator::emplaceBefore(Args&&... args)
 {
     if (this->isPastStart()) {
         throw IteratorException();
     } else if (this->currentNode != this->itrFirstNode) {
         //Create new node with value and correct pointers
-        Node * newNode = new Node;
-        newNode->value = value;
-        newNode->prev = this->currentNode->prev;
-        newNode->next = this->currentNode;
+        Node * newNode = this->baseList.createNode(this->currentNode->prev, this->currentNode, static_cast<Args&&>(args)...);
 
         //Complete existing node pointers
         this->currentNode->prev->next = newNode;
         this->currentNode->prev = newNode;
     } else {
         //Create new node with value and correct pointers
-        Node * newNode = new Node;
-        newNode->value = value;
-        newNode->prev = nullptr;
-        newNode->next = this->currentNode;
+        Node * newNode = this->baseList.createNode(nullptr, this->currentNode, static_cast<Args&&>(args)...);
 
         //Complete existing node pointers
         this->currentNode->prev = newNode;
@@ -753,25 +1096,34 @@ void DoublyLinkedList<ValueType>::Iterator::insertBefore(const ValueType& value)
 
 template <typename ValueType>
 void DoublyLinkedList<ValueType>::Iterator::insertAfter(const ValueType& value)
+{
+    emplaceAfter(value);
+}
+
+
+template <typename ValueType>
+void DoublyLinkedList<ValueType>::Iterator::insertAfter(ValueType&& value)
+{
+    emplaceAfter(static_cast<ValueType&&>(value));
+}
+
+
+template <typename ValueType>
+template <typename... Args>
+void DoublyLinkedList<ValueType>::Iterator::emplaceAfter(Args&&... args)
 {
     if (this->isPastEnd()) {
         throw IteratorException();
     } else if (this->currentNode != this->itrLastNode) {
         //Create new node with value and correct pointers
-        Node * newNode = new Node;
-        newNode->value = value;
-        newNode->prev = this->currentNode;
-        newNode->next = this->currentNode->next;
+        Node * newNode = this->baseList.createNode(this->currentNode, this->currentNode->next, static_cast<Args&&>(args)...);
 
         //Complete existing node pointers
         this->currentNode->next = newNode;
         newNode->next->prev = newNode;
     } else {
         //Create new node with value and correct pointers
-        Node * newNode = new Node;
-        newNode->value = value;
-        newNode->prev = this->currentNode;
-        newNode->next = nullptr;
+        Node * newNode = this->baseList.createNode(this->currentNode, nullptr, static_cast<Args&&>(args)...);
 
         //Complete existing node pointers
         this->currentNode->next = newNode;
@@ -792,7 +1144,7 @@ void DoublyLinkedList<ValueType>::Iterator::remove(bool moveToNextAfterward)
         if (this->currentNode == this->itrFirstNode) { //Current node is the first node
             //Remove the current node and set current node to the next node
             Node * temp = this->currentNode->next;
-            delete this->currentNode;
+            this->baseList.destroyNode(this->currentNode);
             this->currentNode = temp;
 
             //Correct pointers
@@ -802,7 +1154,7 @@ void DoublyLinkedList<ValueType>::Iterator::remove(bool moveToNextAfterward)
         } else if (this->currentNode == this->itrLastNode) { //Current node is the last node
             //Remove the current node and set current node to the prev node
             Node * temp = this->currentNode->prev;
-            delete this->currentNode;
+            this->baseList.destroyNode(this->currentNode);
             this->currentNode = temp;
 
             //Correct pointers
@@ -813,7 +1165,7 @@ void DoublyLinkedList<ValueType>::Iterator::remove(bool moveToNextAfterward)
             //Remove the current node and set current node to the next node
             Node * temp = this->currentNode->next;
             temp->prev = this->currentNode->prev;
-            delete this->currentNode;
+            this->baseList.destroyNode(this->currentNode);
             this->currentNode = temp;
 
             //Correct pointers
@@ -828,6 +1180,149 @@ void DoublyLinkedList<ValueType>::Iterator::remove(bool moveToNextAfterward)
 }
 
 
+template <typename ValueType>
+template <typename... Args>
+DoublyLinkedList<ValueType>::Node::Node(Node* prev, Node* next, Args&&... args)
+    : value(static_cast<Args&&>(args)...), prev{prev}, next{next}
+{
+}
 
-#endif
 
+template <typename ValueType>
+void* DoublyLinkedList<ValueType>::Node::operator new(decltype(sizeof(0)), void* place) noexcept
+{
+    return place;
+}
+
+
+template <typename ValueType>
+void DoublyLinkedList<ValueType>::Node::operator delete(void*, void*) noexcept
+{
+}
+
+
+//Constructs a node's value in place from the given arguments, so that
+//adding a value is a single copy (or move), or none at all
+template <typename ValueType>
+template <typename... Args>
+typename DoublyLinkedList<ValueType>::Node* DoublyLinkedList<ValueType>::createNode(
+    Node* prev, Node* next, Args&&... args)
+{
+    //Reuse a spare slot if there is one, only allocating when there isn't
+    NodeSlot * slot = spareSlots;
+    if (slot != nullptr) {
+        spareSlots = slot->nextSpare;
+    } else {
+        slot = new NodeSlot;
+    }
+
+    try {
+        return new (slot->storage) Node(prev, next, static_cast<Args&&>(args)...);
+    } catch (...) {
+        //Constructing the value failed, so the slot goes back to being spare
+        slot->nextSpare = spareSlots;
+        spareSlots = slot;
+        throw;
+    }
+}
+
+
+template <typename ValueType>
+void DoublyLinkedList<ValueType>::destroyNode(Node* node) noexcept
+{
+    node->~Node();
+
+    NodeSlot * slot = reinterpret_cast<NodeSlot*>(node);
+    slot->nextSpare = spareSlots;
+    spareSlots = slot;
+}
+
+
+template <typename ValueType>
+void DoublyLinkedList<ValueType>::releaseSpareSlots() noexcept
+{
+    while (spareSlots != nullptr) {
+        NodeSlot * nextSlot = spareSlots->nextSpare;
+        delete spareSlots;
+        spareSlots = nextSlot;
+    }
+}
+
+
+template <typename ValueType>
+template <typename LessThan>
+void DoublyLinkedList<ValueType>::mergeChains(Chain& chain, Chain& other, LessThan& lessThan)
+{
+    //Merges the other chain into the first one, which ends up holding all
+    //of their nodes; the other ends up empty
+    Chain merged{nullptr, nullptr};
+
+    try {
+        while (chain.first != nullptr && other.first != nullptr) {
+            //Taking from the first chain on ties keeps the merge stable
+            Chain& source = lessThan(other.first->value, chain.first->value) ? other : chain;
+            Chain node = takeFirst(source);
+            appendChain(merged, node);
+        }
+    } catch (...) {
+        appendChain(merged, chain);
+        appendChain(merged, other);
+        chain = merged;
+        throw;
+    }
+
+    appendChain(merged, chain);
+    appendChain(merged, other);
+    chain = merged;
+}
+
+
+template <typename ValueType>
+void DoublyLinkedList<ValueType>::appendChain(Chain& chain, Chain& other) noexcept
+{
+    if (other.first == nullptr) {
+        return;
+    } else if (chain.first == nullptr) {
+        chain = other;
+    } else {
+        chain.last->next = other.first;
+        chain.last = other.last;
+    }
+
+    other = Chain{nullptr, nullptr};
+}
+
+
+template <typename ValueType>
+typename DoublyLinkedList<ValueType>::Chain DoublyLinkedList<ValueType>::takeFirst(Chain& chain) noexcept
+{
+    Node * node = chain.first;
+    chain.first = node->next;
+    if (chain.first == nullptr) {
+        chain.last = nullptr;
+    }
+
+    node->next = nullptr;
+    return Chain{node, node};
+}
+
+
+//Makes the chain's nodes this list's nodes, restoring the prev pointers
+//that sorting and merging don't maintain
+template <typename ValueType>
+void DoublyLinkedList<ValueType>::adoptChain(const Chain& chain, unsigned int size) noexcept
+{
+    firstNode = chain.first;
+    lastNode = chain.last;
+    listSize = size;
+
+    Node * prev = nullptr;
+    for (Node * node = firstNode; node != nullptr; node = node->next) {
+        node->prev = prev;
+        prev = node;
+    }
+}
+
+
+
+#endif
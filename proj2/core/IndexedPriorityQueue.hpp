@@ -0,0 +1,451 @@
+// IndexedPriorityQueue.hpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// IndexedPriorityQueue<PriorityType> is a priority queue of keys, which
+// are the integers from zero up to (but not including) a fixed number
+// given when it's constructed -- register numbers, say -- each of which
+// can be in the queue at most once, with a priority.  The front of the
+// queue is always the key with the lowest priority (compared with <),
+// with ties going to the lower key.
+//
+// It's a binary min-heap, along with an index that records where each
+// key is in the heap, so that besides enqueuing and dequeuing, a key
+// that's already in the queue can have its priority changed, or be
+// removed, in O(log n) time, rather than by rebuilding the heap.  All of
+// the memory it needs is allocated when it's constructed.
+//
+// Like Queue, this doesn't use the C++ Standard Library.  Priorities
+// must be default-constructible and assignable.
+
+#ifndef INDEXEDPRIORITYQUEUE_HPP
+#define INDEXEDPRIORITYQUEUE_HPP
+
+#include "EmptyException.hpp"
+#include "KeyException.hpp"
+
+
+
+template <typename PriorityType>
+class IndexedPriorityQueue
+{
+public:
+    // Initializes an empty queue that can hold the keys from zero up to
+    // (but not including) the given number.
+    explicit IndexedPriorityQueue(unsigned int keyCount);
+
+    // Initializes this queue as a copy of an existing one.
+    IndexedPriorityQueue(const IndexedPriorityQueue& queue);
+
+    // Initializes this queue from an expiring one, which is left empty
+    // and unable to hold any keys.
+    IndexedPriorityQueue(IndexedPriorityQueue&& queue) noexcept;
+
+    // Destroys the contents of this queue.
+    ~IndexedPriorityQueue() noexcept;
+
+    // Replaces the contents of this queue with a copy of the contents
+    // of an existing one.
+    IndexedPriorityQueue& operator=(const IndexedPriorityQueue& queue);
+
+    // Replaces the contents of this queue with the contents of an
+    // expiring one.
+    IndexedPriorityQueue& operator=(IndexedPriorityQueue&& queue) noexcept;
+
+
+    // enqueue() adds a key to the queue with the given priority.  If the
+    // key is out of range or already in the queue, it throws a
+    // KeyException instead.
+    void enqueue(unsigned int key, const PriorityType& priority);
+
+    // dequeue() removes the front key from the queue, if there is one.
+    // If the queue is empty, it throws an EmptyException instead.
+    void dequeue();
+
+    // remove() removes a key from the queue, wherever it is.  If the key
+    // isn't in the queue, it throws a KeyException instead.
+    void remove(unsigned int key);
+
+
+    // changePriority() gives a key that's in the queue a new priority,
+    // moving it toward the front or back of the queue as needed.  If the
+    // key isn't in the queue, it throws a KeyException instead.
+    void changePriority(unsigned int key, const PriorityType& priority);
+
+    // decreasePriority() gives a key that's in the queue the given
+    // priority if it's lower than the one it has, returning true, or
+    // returns false and leaves the key alone if it isn't.  If the key
+    // isn't in the queue, it throws a KeyException instead.
+    bool decreasePriority(unsigned int key, const PriorityType& priority);
+
+
+    // front() and frontPriority() return the front key in the queue and
+    // its priority, if there is one.  If the queue is empty, they throw
+    // an EmptyException instead.
+    unsigned int front() const;
+    const PriorityType& frontPriority() const;
+
+    // priorityOf() returns the priority of a key in the queue.  If the
+    // key isn't in the queue, it throws a KeyException instead.
+    const PriorityType& priorityOf(unsigned int key) const;
+
+    // contains() returns true if the given key is in the queue, false
+    // otherwise (including if it's out of range).
+    bool contains(unsigned int key) const noexcept;
+
+
+    // isEmpty() returns true if the queue has no keys in it, false
+    // otherwise.
+    bool isEmpty() const noexcept;
+
+    // size() returns the number of keys in the queue.
+    unsigned int size() const noexcept;
+
+    // keyCount() returns the number of keys the queue can hold, which
+    // are the ones from zero up to (but not including) this number.
+    unsigned int keyCount() const noexcept;
+
+
+private:
+    struct Entry
+    {
+        unsigned int key;
+        PriorityType priority;
+    };
+
+    static constexpr unsigned int NOT_QUEUED = ~0u;
+
+    // The heap is entries[0] through entries[queueSize - 1], where the
+    // children of entries[i] are entries[2i + 1] and entries[2i + 2].
+    // positions[key] is where the key is in the heap, or NOT_QUEUED.
+    Entry * entries;
+    unsigned int * positions;
+    unsigned int keys;
+    unsigned int queueSize;
+
+    static bool comesBefore(const Entry& a, const Entry& b);
+    unsigned int positionOf(unsigned int key) const;
+    void place(unsigned int position, Entry& entry) noexcept;
+    void siftUp(unsigned int position);
+    void siftDown(unsigned int position);
+    void removeAt(unsigned int position);
+};
+
+
+
+template <typename PriorityType>
+IndexedPriorityQueue<PriorityType>::IndexedPriorityQueue(unsigned int keyCount)
+    : entries{nullptr}, positions{nullptr}, keys{keyCount}, queueSize{0}
+{
+    entries = new Entry[keyCount];
+
+    try {
+        positions = new unsigned int[keyCount];
+    } catch (...) {
+        delete[] entries;
+        throw;
+    }
+
+    for (unsigned int key = 0; key < keyCount; ++key) {
+        positions[key] = NOT_QUEUED;
+    }
+}
+
+
+template <typename PriorityType>
+IndexedPriorityQueue<PriorityType>::IndexedPriorityQueue(const IndexedPriorityQueue& queue)
+    : IndexedPriorityQueue{queue.keys}
+{
+    for (unsigned int i = 0; i < queue.queueSize; ++i) {
+        entries[i] = queue.entries[i];
+    }
+
+    for (unsigned int key = 0; key < keys; ++key) {
+        positions[key] = queue.positions[key];
+    }
+
+    queueSize = queue.queueSize;
+}
+
+
+template <typename PriorityType>
+IndexedPriorityQueue<PriorityType>::IndexedPriorityQueue(IndexedPriorityQueue&& queue) noexcept
+    : entries{queue.entries}, positions{queue.positions}, keys{queue.keys}, queueSize{queue.queueSize}
+{
+    queue.entries = nullptr;
+    queue.positions = nullptr;
+    queue.keys = 0;
+    queue.queueSize = 0;
+}
+
+
+template <typename PriorityType>
+IndexedPriorityQueue<PriorityType>::~IndexedPriorityQueue() noexcept
+{
+    delete[] entries;
+    delete[] positions;
+}
+
+
+template <typename PriorityType>
+IndexedPriorityQueue<PriorityType>& IndexedPriorityQueue<PriorityType>::operator=(
+    const IndexedPriorityQueue& queue)
+{
+    if (this != &queue) {
+        IndexedPriorityQueue copy{queue};
+        *this = static_cast<IndexedPriorityQueue&&>(copy);
+    }
+    return *this;
+}
+
+
+template <typename PriorityType>
+IndexedPriorityQueue<PriorityType>& IndexedPriorityQueue<PriorityType>::operator=(
+    IndexedPriorityQueue&& queue) noexcept
+{
+    Entry * tempEntries = entries;
+    entries = queue.entries;
+    queue.entries = tempEntries;
+
+    unsigned int * tempPositions = positions;
+    positions = queue.positions;
+    queue.positions = tempPositions;
+
+    unsigned int temp = keys;
+    keys = queue.keys;
+    queue.keys = temp;
+
+    temp = queueSize;
+    queueSize = queue.queueSize;
+    queue.queueSize = temp;
+
+    return *this;
+}
+
+
+template <typename PriorityType>
+void IndexedPriorityQueue<PriorityType>::enqueue(unsigned int key, const PriorityType& priority)
+{
+    if (key >= keys || positions[key] != NOT_QUEUED) {
+        throw KeyException();
+    }
+
+    entries[queueSize].key = key;
+    entries[queueSize].priority = priority;
+    positions[key] = queueSize;
+    queueSize++;
+
+    siftUp(queueSize - 1);
+}
+
+
+template <typename PriorityType>
+void IndexedPriorityQueue<PriorityType>::dequeue()
+{
+    if (queueSize == 0) {
+        throw EmptyException();
+    }
+
+    removeAt(0);
+}
+
+
+template <typename PriorityType>
+void IndexedPriorityQueue<PriorityType>::remove(unsigned int key)
+{
+    removeAt(positionOf(key));
+}
+
+
+template <typename PriorityType>
+void IndexedPriorityQueue<PriorityType>::changePriority(unsigned int key, const PriorityType& priority)
+{
+    unsigned int position = positionOf(key);
+    entries[position].priority = priority;
+
+    //Only one of these will actually move it
+    siftUp(position);
+    siftDown(positions[key]);
+}
+
+
+template <typename PriorityType>
+bool IndexedPriorityQueue<PriorityType>::decreasePriority(unsigned int key, const PriorityType& priority)
+{
+    unsigned int position = positionOf(key);
+    if (!(priority < entries[position].priority)) {
+        return false;
+    }
+
+    entries[position].priority = priority;
+    siftUp(position);
+    return true;
+}
+
+
+template <typename PriorityType>
+unsigned int IndexedPriorityQueue<PriorityType>::front() const
+{
+    if (queueSize == 0) {
+        throw EmptyException();
+    }
+
+    return entries[0].key;
+}
+
+
+template <typename PriorityType>
+const PriorityType& IndexedPriorityQueue<PriorityType>::frontPriority() const
+{
+    if (queueSize == 0) {
+        throw EmptyException();
+    }
+
+    return entries[0].priority;
+}
+
+
+template <typename PriorityType>
+const PriorityType& IndexedPriorityQueue<PriorityType>::priorityOf(unsigned int key) const
+{
+    return entries[positionOf(key)].priority;
+}
+
+
+template <typename PriorityType>
+bool IndexedPriorityQueue<PriorityType>::contains(unsigned int key) const noexcept
+{
+    return key < keys && positions[key] != NOT_QUEUED;
+}
+
+
+template <typename PriorityType>
+bool IndexedPriorityQueue<PriorityType>::isEmpty() const noexcept
+{
+    return queueSize == 0;
+}
+
+
+template <typename PriorityType>
+unsigned int IndexedPriorityQueue<PriorityType>::size() const noexcept
+{
+    return queueSize;
+}
+
+
+template <typename PriorityType>
+unsigned int IndexedPriorityQueue<PriorityType>::keyCount() const noexcept
+{
+    return keys;
+}
+
+
+//Lower priorities come first, then lower keys
+template <typename PriorityType>
+bool IndexedPriorityQueue<PriorityType>::comesBefore(const Entry& a, const Entry& b)
+{
+    if (a.priority < b.priority) {
+        return true;
+    } else if (b.priority < a.priority) {
+        return false;
+    } else {
+        return a.key < b.key;
+    }
+}
+
+
+//Where a key is in the heap, throwing a KeyException if it isn't there
+template <typename PriorityType>
+unsigned int IndexedPriorityQueue<PriorityType>::positionOf(unsigned int key) const
+{
+    if (!contains(key)) {
+        throw KeyException();
+    }
+
+    return positions[key];
+}
+
+
+template <typename PriorityType>
+void IndexedPriorityQueue<PriorityType>::place(unsigned int position, Entry& entry) noexcept
+{
+    entries[position] = static_cast<Entry&&>(entry);
+    positions[entries[position].key] = position;
+}
+
+
+//Moves the entry at the given position toward the root until its parent
+//comes before it, shifting each parent it passes down into the hole it
+//leaves rather than swapping the two
+template <typename PriorityType>
+void IndexedPriorityQueue<PriorityType>::siftUp(unsigned int position)
+{
+    if (position == 0 || !comesBefore(entries[position], entries[(position - 1) / 2])) {
+        return;
+    }
+
+    Entry moving = static_cast<Entry&&>(entries[position]);
+
+    do {
+        unsigned int parent = (position - 1) / 2;
+        place(position, entries[parent]);
+        position = parent;
+    } while (position > 0 && comesBefore(moving, entries[(position - 1) / 2]));
+
+    place(position, moving);
+}
+
+
+//Moves the entry at the given position toward the leaves until neither
+//child comes before it, the same way
+template <typename PriorityType>
+void IndexedPriorityQueue<PriorityType>::siftDown(unsigned int position)
+{
+    Entry moving = static_cast<Entry&&>(entries[position]);
+
+    while (true) {
+        unsigned int child = 2 * position + 1;
+        if (child >= queueSize) {
+            break;
+        }
+
+        if (child + 1 < queueSize && comesBefore(entries[child + 1], entries[child])) {
+            child++;
+        }
+
+        if (!comesBefore(entries[child], moving)) {
+            break;
+        }
+
+        place(position, entries[child]);
+        position = child;
+    }
+
+    place(position, moving);
+}
+
+
+//Fills the hole left by the removed entry with the last one, which then
+//moves whichever way it needs to
+template <typename PriorityType>
+void IndexedPriorityQueue<PriorityType>::removeAt(unsigned int position)
+{
+    positions[entries[position].key] = NOT_QUEUED;
+    queueSize--;
+
+    if (position == queueSize) {
+        return;
+    }
+
+    unsigned int key = entries[queueSize].key;
+    place(position, entries[queueSize]);
+
+    //Only one of these will actually move it
+    siftUp(position);
+    siftDown(positions[key]);
+}
+
+
+
+#endif
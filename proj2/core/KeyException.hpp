@@ -0,0 +1,21 @@
+// KeyException.hpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// An exception to throw when a data structure is given a key that it
+// can't do what's asked with (e.g., a key that's out of range, or one
+// that's expected to be present but isn't).
+
+#ifndef KEYEXCEPTION_HPP
+#define KEYEXCEPTION_HPP
+
+
+
+class KeyException
+{
+};
+
+
+
+#endif
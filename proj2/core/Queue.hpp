@@ -57,6 +57,13 @@ public:
     // enqueue() adds the given value to the back of the queue, after
     // all of the ones that are already stored within.
     void enqueue(const ValueType& value);
+    void enqueue(ValueType&& value);
+
+    // emplace() adds a new value to the back of the queue, constructing
+    // it in place from the given arguments rather than copying or moving
+    // an existing one.
+    template <typename... Args>
+    void emplace(Args&&... args);
 
     // dequeue() removes the front value from the queue, if there is
     // one.  If the queue is empty, it throws an EmptyException instead.
@@ -110,6 +117,21 @@ void Queue<ValueType>::enqueue(const ValueType& value)
 }
 
 
+template <typename ValueType>
+void Queue<ValueType>::enqueue(ValueType&& value)
+{
+    this->addToEnd(static_cast<ValueType&&>(value));
+}
+
+
+template <typename ValueType>
+template <typename... Args>
+void Queue<ValueType>::emplace(Args&&... args)
+{
+    this->emplaceBack(static_cast<Args&&>(args)...);
+}
+
+
 template <typename ValueType>
 void Queue<ValueType>::dequeue()
 {
@@ -0,0 +1,591 @@
+// RingQueue.hpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// RingQueue<ValueType> is a queue with the same interface as
+// Queue<ValueType>, but which stores its values in one contiguous array
+// used as a ring: the front of the queue moves forward through the
+// array as values are dequeued, and the back wraps around to the
+// beginning of the array when it reaches the end.  Enqueuing only
+// allocates when the array is full, at which point its capacity doubles,
+// so a queue whose size stays about the same never allocates at all.
+//
+// Beyond Queue's interface, a RingQueue can have values moved into it
+// or constructed in place (emplace()), and can enqueue or dequeue a
+// batch of values at once.
+//
+// Like Queue, this doesn't use the C++ Standard Library.
+
+#ifndef RINGQUEUE_HPP
+#define RINGQUEUE_HPP
+
+#include "EmptyException.hpp"
+#include "IteratorException.hpp"
+
+
+
+template <typename ValueType>
+class RingQueue
+{
+public:
+    class ConstIterator;
+
+
+public:
+    // Initializes this queue to be empty, without allocating.
+    RingQueue() noexcept;
+
+    // Initializes this queue as a copy of an existing one.
+    RingQueue(const RingQueue& queue);
+
+    // Initializes this queue from an expiring one, which is left empty.
+    RingQueue(RingQueue&& queue) noexcept;
+
+    // Destroys the contents of this queue.
+    ~RingQueue() noexcept;
+
+    // Replaces the contents of this queue with a copy of the contents
+    // of an existing one.
+    RingQueue& operator=(const RingQueue& queue);
+
+    // Replaces the contents of this queue with the contents of an
+    // expiring one.
+    RingQueue& operator=(RingQueue&& queue) noexcept;
+
+
+    // enqueue() adds the given value to the back of the queue, after
+    // all of the ones that are already stored within, either by copying
+    // it or by moving it.
+    void enqueue(const ValueType& value);
+    void enqueue(ValueType&& value);
+
+    // emplace() adds a value to the back of the queue, constructing it
+    // in place from the given arguments, as if by ValueType(args...).
+    template <typename... Args>
+    void emplace(Args&&... args);
+
+    // enqueueRange() adds copies of count values, starting with the one
+    // that values points to, to the back of the queue, in order.  It
+    // allocates at most once.
+    void enqueueRange(const ValueType* values, unsigned int count);
+
+    // dequeue() removes the front value from the queue, if there is
+    // one.  If the queue is empty, it throws an EmptyException instead.
+    void dequeue();
+
+    // dequeueN() removes up to count values from the front of the queue,
+    // moving them into the array that values points to, in order, and
+    // returns how many there were.  It never throws unless moving a
+    // value does.
+    unsigned int dequeueN(ValueType* values, unsigned int count);
+
+    // front() returns the front value in the queue, if there is one.
+    // If the queue is empty, it throws an EmptyException instead.
+    const ValueType& front() const;
+
+
+    // isEmpty() returns true if the queue has no values in it, false
+    // otherwise.
+    bool isEmpty() const noexcept;
+
+    // size() returns the number of values in the queue.
+    unsigned int size() const noexcept;
+
+    // capacity() returns the number of values the queue can hold before
+    // it has to allocate more memory.
+    unsigned int capacity() const noexcept;
+
+    // reserve() makes sure the queue can hold at least the given number
+    // of values without allocating again.
+    void reserve(unsigned int newCapacity);
+
+
+    // constIterator() creates a new ConstIterator over this queue, which
+    // visits its values from front to back.  It will initially be
+    // referring to the front value, unless the queue is empty, in which
+    // case it will be considered both "past start" and "past end".
+    ConstIterator constIterator() const;
+
+
+public:
+    // A ConstIterator behaves the way DoublyLinkedList's does, so that
+    // code iterating over a Queue can iterate over a RingQueue instead.
+    // It's only valid until the queue is modified.
+    class ConstIterator
+    {
+    public:
+        ConstIterator(const RingQueue& queue) noexcept;
+
+        void moveToNext();
+        void moveToPrevious();
+
+        bool isPastStart() const noexcept;
+        bool isPastEnd() const noexcept;
+
+        const ValueType& value() const;
+
+    private:
+        const RingQueue * itrQueue;
+
+        // The position of the value this iterator refers to, counting
+        // from the front, where -1 is "past start" and the queue's size
+        // is "past end".
+        int position;
+    };
+
+
+private:
+    // Each value is stored in an Element, constructed in place in one
+    // of the slots of the array, which is what the placement form of
+    // operator new is for.
+    struct Element
+    {
+        ValueType value;
+
+        template <typename... Args>
+        Element(Args&&... args);
+
+        static void* operator new(decltype(sizeof(0)), void* place) noexcept;
+        static void operator delete(void*, void*) noexcept;
+    };
+
+    struct Slot
+    {
+        alignas(Element) unsigned char storage[sizeof(Element)];
+    };
+
+    static constexpr unsigned int INITIAL_CAPACITY = 8;
+
+    // The values are in slots[head], slots[head + 1], and so on, wrapping
+    // around at the end of the array.  The capacity is always zero or a
+    // power of two, so that wrapping around is a matter of masking.
+    Slot * slots;
+    unsigned int queueCapacity;
+    unsigned int head;
+    unsigned int queueSize;
+
+    ValueType& valueAt(unsigned int position) const noexcept;
+    unsigned int slotOf(unsigned int position) const noexcept;
+    void destroyAll() noexcept;
+    void reallocate(unsigned int newCapacity);
+    void moveInto(Slot* newSlots, unsigned int newCapacity);
+    unsigned int grownCapacity(unsigned int count) const noexcept;
+};
+
+
+
+template <typename ValueType>
+RingQueue<ValueType>::RingQueue() noexcept
+    : slots{nullptr}, queueCapacity{0}, head{0}, queueSize{0}
+{
+}
+
+
+template <typename ValueType>
+RingQueue<ValueType>::RingQueue(const RingQueue& queue)
+    : RingQueue{}
+{
+    if (queue.queueSize == 0) {
+        return;
+    }
+
+    reserve(queue.queueSize);
+
+    try {
+        for (unsigned int i = 0; i < queue.queueSize; ++i) {
+            new (slots[i].storage) Element(queue.valueAt(i));
+            queueSize++;
+        }
+    } catch (...) {
+        destroyAll();
+        throw;
+    }
+}
+
+
+template <typename ValueType>
+RingQueue<ValueType>::RingQueue(RingQueue&& queue) noexcept
+    : slots{queue.slots}, queueCapacity{queue.queueCapacity}, head{queue.head}, queueSize{queue.queueSize}
+{
+    queue.slots = nullptr;
+    queue.queueCapacity = 0;
+    queue.head = 0;
+    queue.queueSize = 0;
+}
+
+
+template <typename ValueType>
+RingQueue<ValueType>::~RingQueue() noexcept
+{
+    destroyAll();
+}
+
+
+template <typename ValueType>
+RingQueue<ValueType>& RingQueue<ValueType>::operator=(const RingQueue& queue)
+{
+    if (this != &queue) {
+        RingQueue copy{queue};
+        *this = static_cast<RingQueue&&>(copy);
+    }
+    return *this;
+}
+
+
+template <typename ValueType>
+RingQueue<ValueType>& RingQueue<ValueType>::operator=(RingQueue&& queue) noexcept
+{
+    Slot * tempSlots = slots;
+    slots = queue.slots;
+    queue.slots = tempSlots;
+
+    unsigned int temp = queueCapacity;
+    queueCapacity = queue.queueCapacity;
+    queue.queueCapacity = temp;
+
+    temp = head;
+    head = queue.head;
+    queue.head = temp;
+
+    temp = queueSize;
+    queueSize = queue.queueSize;
+    queue.queueSize = temp;
+
+    return *this;
+}
+
+
+template <typename ValueType>
+void RingQueue<ValueType>::enqueue(const ValueType& value)
+{
+    emplace(value);
+}
+
+
+template <typename ValueType>
+void RingQueue<ValueType>::enqueue(ValueType&& value)
+{
+    emplace(static_cast<ValueType&&>(value));
+}
+
+
+template <typename ValueType>
+template <typename... Args>
+void RingQueue<ValueType>::emplace(Args&&... args)
+{
+    if (queueSize < queueCapacity) {
+        new (slots[slotOf(queueSize)].storage) Element(static_cast<Args&&>(args)...);
+    } else {
+        //The new value is constructed before the others are moved, since
+        //the arguments might refer to one of them
+        unsigned int newCapacity = queueCapacity != 0 ? queueCapacity * 2 : INITIAL_CAPACITY;
+        Slot * newSlots = new Slot[newCapacity];
+
+        try {
+            new (newSlots[queueSize].storage) Element(static_cast<Args&&>(args)...);
+        } catch (...) {
+            delete[] newSlots;
+            throw;
+        }
+
+        try {
+            moveInto(newSlots, newCapacity);
+        } catch (...) {
+            reinterpret_cast<Element*>(newSlots[queueSize].storage)->~Element();
+            delete[] newSlots;
+            throw;
+        }
+    }
+    queueSize++;
+}
+
+
+template <typename ValueType>
+void RingQueue<ValueType>::enqueueRange(const ValueType* values, unsigned int count)
+{
+    if (queueSize + count <= queueCapacity) {
+        unsigned int added = 0;
+
+        try {
+            for (; added < count; ++added) {
+                new (slots[slotOf(queueSize + added)].storage) Element(values[added]);
+            }
+        } catch (...) {
+            //Undo the part of the batch that was added, so the queue is unchanged
+            for (unsigned int i = 0; i < added; ++i) {
+                valueAt(queueSize + i).~ValueType();
+            }
+            throw;
+        }
+    } else {
+        //As in emplace(), the new values are copied before the others are
+        //moved, since values might point into this queue's own array
+        unsigned int newCapacity = grownCapacity(count);
+        Slot * newSlots = new Slot[newCapacity];
+        unsigned int added = 0;
+
+        try {
+            for (; added < count; ++added) {
+                new (newSlots[queueSize + added].storage) Element(values[added]);
+            }
+
+            moveInto(newSlots, newCapacity);
+        } catch (...) {
+            for (unsigned int i = 0; i < added; ++i) {
+                reinterpret_cast<Element*>(newSlots[queueSize + i].storage)->~Element();
+            }
+            delete[] newSlots;
+            throw;
+        }
+    }
+
+    queueSize += count;
+}
+
+
+template <typename ValueType>
+void RingQueue<ValueType>::dequeue()
+{
+    if (queueSize == 0) {
+        throw EmptyException();
+    }
+
+    valueAt(0).~ValueType();
+    head = slotOf(1);
+    queueSize--;
+}
+
+
+template <typename ValueType>
+unsigned int RingQueue<ValueType>::dequeueN(ValueType* values, unsigned int count)
+{
+    if (count > queueSize) {
+        count = queueSize;
+    }
+
+    for (unsigned int i = 0; i < count; ++i) {
+        values[i] = static_cast<ValueType&&>(valueAt(0));
+        valueAt(0).~ValueType();
+        head = slotOf(1);
+        queueSize--;
+    }
+
+    return count;
+}
+
+
+template <typename ValueType>
+const ValueType& RingQueue<ValueType>::front() const
+{
+    if (queueSize == 0) {
+        throw EmptyException();
+    }
+    return valueAt(0);
+}
+
+
+template <typename ValueType>
+bool RingQueue<ValueType>::isEmpty() const noexcept
+{
+    return queueSize == 0;
+}
+
+
+template <typename ValueType>
+unsigned int RingQueue<ValueType>::size() const noexcept
+{
+    return queueSize;
+}
+
+
+template <typename ValueType>
+unsigned int RingQueue<ValueType>::capacity() const noexcept
+{
+    return queueCapacity;
+}
+
+
+template <typename ValueType>
+void RingQueue<ValueType>::reserve(unsigned int newCapacity)
+{
+    if (newCapacity > queueCapacity) {
+        unsigned int roundedCapacity = 1;
+        while (roundedCapacity < newCapacity) {
+            roundedCapacity *= 2;
+        }
+        reallocate(roundedCapacity);
+    }
+}
+
+
+template <typename ValueType>
+typename RingQueue<ValueType>::ConstIterator RingQueue<ValueType>::constIterator() const
+{
+    return ConstIterator{*this};
+}
+
+
+template <typename ValueType>
+RingQueue<ValueType>::ConstIterator::ConstIterator(const RingQueue& queue) noexcept
+    : itrQueue{&queue}, position{0}
+{
+}
+
+
+template <typename ValueType>
+void RingQueue<ValueType>::ConstIterator::moveToNext()
+{
+    if (isPastEnd()) {
+        throw IteratorException();
+    }
+    position++;
+}
+
+
+template <typename ValueType>
+void RingQueue<ValueType>::ConstIterator::moveToPrevious()
+{
+    if (isPastStart()) {
+        throw IteratorException();
+    }
+    position--;
+}
+
+
+template <typename ValueType>
+bool RingQueue<ValueType>::ConstIterator::isPastStart() const noexcept
+{
+    return itrQueue->queueSize == 0 || position < 0;
+}
+
+
+template <typename ValueType>
+bool RingQueue<ValueType>::ConstIterator::isPastEnd() const noexcept
+{
+    return itrQueue->queueSize == 0 || position >= static_cast<int>(itrQueue->queueSize);
+}
+
+
+template <typename ValueType>
+const ValueType& RingQueue<ValueType>::ConstIterator::value() const
+{
+    if (isPastStart() || isPastEnd()) {
+        throw IteratorException();
+    }
+    return itrQueue->valueAt(position);
+}
+
+
+template <typename ValueType>
+template <typename... Args>
+RingQueue<ValueType>::Element::Element(Args&&... args)
+    : value(static_cast<Args&&>(args)...)
+{
+}
+
+
+template <typename ValueType>
+void* RingQueue<ValueType>::Element::operator new(decltype(sizeof(0)), void* place) noexcept
+{
+    return place;
+}
+
+
+template <typename ValueType>
+void RingQueue<ValueType>::Element::operator delete(void*, void*) noexcept
+{
+}
+
+
+//Returns the value at the given position, counting from the front
+template <typename ValueType>
+ValueType& RingQueue<ValueType>::valueAt(unsigned int position) const noexcept
+{
+    return reinterpret_cast<Element*>(slots[slotOf(position)].storage)->value;
+}
+
+
+template <typename ValueType>
+unsigned int RingQueue<ValueType>::slotOf(unsigned int position) const noexcept
+{
+    return (head + position) & (queueCapacity - 1);
+}
+
+
+template <typename ValueType>
+void RingQueue<ValueType>::destroyAll() noexcept
+{
+    for (unsigned int i = 0; i < queueSize; ++i) {
+        valueAt(i).~ValueType();
+    }
+
+    delete[] slots;
+    slots = nullptr;
+    queueCapacity = 0;
+    head = 0;
+    queueSize = 0;
+}
+
+
+template <typename ValueType>
+void RingQueue<ValueType>::reallocate(unsigned int newCapacity)
+{
+    Slot * newSlots = new Slot[newCapacity];
+
+    try {
+        moveInto(newSlots, newCapacity);
+    } catch (...) {
+        delete[] newSlots;
+        throw;
+    }
+}
+
+
+//Moves the values, in order, to the start of a new array with room for
+//newCapacity of them (which must be a power of two), and switches to it.
+//The old values are only destroyed once all of them have been moved, so
+//if a move throws, the ones moved so far are destroyed and the queue
+//keeps its old array (though the values that were moved from may have
+//been changed by it).
+template <typename ValueType>
+void RingQueue<ValueType>::moveInto(Slot* newSlots, unsigned int newCapacity)
+{
+    unsigned int moved = 0;
+
+    try {
+        for (; moved < queueSize; ++moved) {
+            new (newSlots[moved].storage) Element(static_cast<ValueType&&>(valueAt(moved)));
+        }
+    } catch (...) {
+        for (unsigned int i = 0; i < moved; ++i) {
+            reinterpret_cast<Element*>(newSlots[i].storage)->~Element();
+        }
+        throw;
+    }
+
+    for (unsigned int i = 0; i < queueSize; ++i) {
+        valueAt(i).~ValueType();
+    }
+
+    delete[] slots;
+    slots = newSlots;
+    queueCapacity = newCapacity;
+    head = 0;
+}
+
+
+//Returns the capacity the array should grow to when it needs room for
+//count more values: at least double, and always a power of two
+template <typename ValueType>
+unsigned int RingQueue<ValueType>::grownCapacity(unsigned int count) const noexcept
+{
+    unsigned int newCapacity = queueCapacity != 0 ? queueCapacity * 2 : INITIAL_CAPACITY;
+    while (newCapacity < queueSize + count) {
+        newCapacity *= 2;
+    }
+    return newCapacity;
+}
+
+
+#endif
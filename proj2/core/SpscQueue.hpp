@@ -0,0 +1,332 @@
+// SpscQueue.hpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// SpscQueue<ValueType> is a fixed-capacity queue that one thread (the
+// "producer") can enqueue into while another thread (the "consumer")
+// dequeues from it, without either of them ever taking a lock.  Only
+// the producer may call the enqueuing member functions, and only the
+// consumer may call dequeue(), tryDequeue() and front(); isEmpty(),
+// size() and capacity() can be called from either.
+//
+// The values are kept in a ring, like RingQueue's.  The producer only
+// writes the index of the back of the queue and the consumer only
+// writes the index of the front, and each index is on a cache line of
+// its own, so the two threads don't slow each other down by writing to
+// the same cache line.  Each thread also keeps its own copy of the
+// other's index, only rereading the real one when its copy says the
+// queue is full (or empty).
+//
+// The indices are shared using the compiler's atomic builtins rather
+// than std::atomic; the only part of the C++ Standard Library used here
+// is std::this_thread::yield(), so that a producer waiting for room
+// doesn't keep the consumer from running.
+
+#ifndef SPSCQUEUE_HPP
+#define SPSCQUEUE_HPP
+
+#include <thread>
+#include "EmptyException.hpp"
+
+
+
+template <typename ValueType>
+class SpscQueue
+{
+public:
+    // Initializes an empty queue with room for at least the given number
+    // of values (which is rounded up to a power of two).
+    explicit SpscQueue(unsigned int capacity);
+
+    // Destroys the queue and any values still in it.  Neither thread can
+    // be using the queue at the time.
+    ~SpscQueue() noexcept;
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+
+    // tryEnqueue() adds the given value to the back of the queue and
+    // returns true, or returns false without doing anything if the
+    // queue is full.  tryEmplace() does the same, constructing the value
+    // in place as if by ValueType(args...).  (Producer only.)
+    bool tryEnqueue(const ValueType& value);
+    bool tryEnqueue(ValueType&& value);
+
+    template <typename... Args>
+    bool tryEmplace(Args&&... args);
+
+    // enqueue() adds the given value to the back of the queue, waiting
+    // for the consumer to make room if the queue is full.  (Producer
+    // only.)
+    void enqueue(const ValueType& value);
+    void enqueue(ValueType&& value);
+
+
+    // tryDequeue() moves the front value out of the queue into the given
+    // variable and returns true, or returns false without doing anything
+    // if the queue is empty.  (Consumer only.)
+    bool tryDequeue(ValueType& value);
+
+    // dequeue() removes the front value from the queue.  If the queue is
+    // empty, it throws an EmptyException instead.  (Consumer only.)
+    void dequeue();
+
+    // front() returns the front value in the queue.  If the queue is
+    // empty, it throws an EmptyException instead.  (Consumer only.)
+    const ValueType& front() const;
+
+
+    // isEmpty() and size() describe the queue as it was at some moment
+    // during the call; by the time they return, the other thread may
+    // have changed it.
+    bool isEmpty() const noexcept;
+    unsigned int size() const noexcept;
+
+    // capacity() returns the number of values the queue can hold.
+    unsigned int capacity() const noexcept;
+
+
+private:
+    static constexpr unsigned int CACHE_LINE_SIZE = 64;
+
+    // The number of times enqueue() tries again right away before it
+    // starts yielding to other threads between attempts.
+    static constexpr unsigned int SPINS_BEFORE_YIELDING = 64;
+
+    // Each value is stored in an Element, constructed in place in one
+    // of the slots of the array, which is what the placement form of
+    // operator new is for.
+    struct Element
+    {
+        ValueType value;
+
+        template <typename... Args>
+        Element(Args&&... args);
+
+        static void* operator new(decltype(sizeof(0)), void* place) noexcept;
+        static void operator delete(void*, void*) noexcept;
+    };
+
+    struct Slot
+    {
+        alignas(Element) unsigned char storage[sizeof(Element)];
+    };
+
+    Slot * slots;
+    unsigned int mask;
+
+    // head and tail count the values that have ever been dequeued and
+    // enqueued, wrapping around at 2^32; the queue's values are in the
+    // slots from head to tail (modulo the capacity).  The producer owns
+    // tail and the consumer owns head, and each keeps a possibly
+    // out-of-date copy of the other's.
+    alignas(CACHE_LINE_SIZE) unsigned int tail;
+    unsigned int producerHead;
+
+    alignas(CACHE_LINE_SIZE) unsigned int head;
+    mutable unsigned int consumerTail;
+
+    alignas(CACHE_LINE_SIZE) char padding;
+
+    ValueType& valueAt(unsigned int index) const noexcept;
+    bool waitingForValue(unsigned int index) const noexcept;
+};
+
+
+
+template <typename ValueType>
+SpscQueue<ValueType>::SpscQueue(unsigned int capacity)
+    : slots{nullptr}, mask{0}, tail{0}, producerHead{0}, head{0}, consumerTail{0}
+{
+    unsigned int roundedCapacity = 1;
+    while (roundedCapacity < capacity) {
+        roundedCapacity *= 2;
+    }
+
+    slots = new Slot[roundedCapacity];
+    mask = roundedCapacity - 1;
+}
+
+
+template <typename ValueType>
+SpscQueue<ValueType>::~SpscQueue() noexcept
+{
+    for (unsigned int index = head; index != tail; ++index) {
+        valueAt(index).~ValueType();
+    }
+
+    delete[] slots;
+}
+
+
+template <typename ValueType>
+bool SpscQueue<ValueType>::tryEnqueue(const ValueType& value)
+{
+    return tryEmplace(value);
+}
+
+
+template <typename ValueType>
+bool SpscQueue<ValueType>::tryEnqueue(ValueType&& value)
+{
+    return tryEmplace(static_cast<ValueType&&>(value));
+}
+
+
+template <typename ValueType>
+template <typename... Args>
+bool SpscQueue<ValueType>::tryEmplace(Args&&... args)
+{
+    unsigned int index = tail;
+
+    if (index - producerHead > mask) {
+        //Looks full, but the consumer may have made room since we last checked
+        producerHead = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+        if (index - producerHead > mask) {
+            return false;
+        }
+    }
+
+    new (slots[index & mask].storage) Element(static_cast<Args&&>(args)...);
+
+    //Publish the value only once it's completely constructed
+    __atomic_store_n(&tail, index + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+
+template <typename ValueType>
+void SpscQueue<ValueType>::enqueue(const ValueType& value)
+{
+    for (unsigned int attempts = 1; !tryEmplace(value); ++attempts) {
+        if (attempts >= SPINS_BEFORE_YIELDING) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+
+template <typename ValueType>
+void SpscQueue<ValueType>::enqueue(ValueType&& value)
+{
+    //A failed attempt doesn't construct anything, so value is only moved
+    //from by the attempt that succeeds
+    for (unsigned int attempts = 1; !tryEmplace(static_cast<ValueType&&>(value)); ++attempts) {
+        if (attempts >= SPINS_BEFORE_YIELDING) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+
+template <typename ValueType>
+bool SpscQueue<ValueType>::tryDequeue(ValueType& value)
+{
+    unsigned int index = head;
+
+    if (waitingForValue(index)) {
+        return false;
+    }
+
+    value = static_cast<ValueType&&>(valueAt(index));
+    valueAt(index).~ValueType();
+
+    //Hand the slot back to the producer only once we're done with it
+    __atomic_store_n(&head, index + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+
+template <typename ValueType>
+void SpscQueue<ValueType>::dequeue()
+{
+    unsigned int index = head;
+
+    if (waitingForValue(index)) {
+        throw EmptyException();
+    }
+
+    valueAt(index).~ValueType();
+    __atomic_store_n(&head, index + 1, __ATOMIC_RELEASE);
+}
+
+
+template <typename ValueType>
+const ValueType& SpscQueue<ValueType>::front() const
+{
+    if (waitingForValue(head)) {
+        throw EmptyException();
+    }
+    return valueAt(head);
+}
+
+
+template <typename ValueType>
+bool SpscQueue<ValueType>::isEmpty() const noexcept
+{
+    return size() == 0;
+}
+
+
+template <typename ValueType>
+unsigned int SpscQueue<ValueType>::size() const noexcept
+{
+    //Read head first, so that the difference can't be negative
+    unsigned int front = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+    unsigned int back = __atomic_load_n(&tail, __ATOMIC_ACQUIRE);
+    return back - front;
+}
+
+
+template <typename ValueType>
+unsigned int SpscQueue<ValueType>::capacity() const noexcept
+{
+    return mask + 1;
+}
+
+
+template <typename ValueType>
+template <typename... Args>
+SpscQueue<ValueType>::Element::Element(Args&&... args)
+    : value(static_cast<Args&&>(args)...)
+{
+}
+
+
+template <typename ValueType>
+void* SpscQueue<ValueType>::Element::operator new(decltype(sizeof(0)), void* place) noexcept
+{
+    return place;
+}
+
+
+template <typename ValueType>
+void SpscQueue<ValueType>::Element::operator delete(void*, void*) noexcept
+{
+}
+
+
+template <typename ValueType>
+ValueType& SpscQueue<ValueType>::valueAt(unsigned int index) const noexcept
+{
+    return reinterpret_cast<Element*>(slots[index & mask].storage)->value;
+}
+
+
+//Returns true if the producer hasn't yet enqueued the value that will
+//have the given index, rereading the real tail only when the consumer's
+//copy says so
+template <typename ValueType>
+bool SpscQueue<ValueType>::waitingForValue(unsigned int index) const noexcept
+{
+    if (index == consumerTail) {
+        consumerTail = __atomic_load_n(&tail, __ATOMIC_ACQUIRE);
+    }
+    return index == consumerTail;
+}
+
+
+
+#endif
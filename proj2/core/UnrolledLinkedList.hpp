@@ -0,0 +1,909 @@
+// UnrolledLinkedList.hpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// UnrolledLinkedList<ValueType> is a class template with the core of
+// DoublyLinkedList<ValueType>'s public interface -- adding and removing
+// at either end, first(), last(), isEmpty(), size(), and iterators that
+// can move both ways, insert before and after, and remove -- but not its
+// move and emplace insertions or its splice(), splitAt(), merge(), and
+// sort().  It stores its values differently: instead of one node per
+// value, each node (a "chunk") holds up to ChunkCapacity values, next
+// to one another in memory.  Iterating through the list then mostly
+// moves from one value to the next within a chunk, rather than following
+// a pointer to somewhere else in memory for every value, and there are
+// far fewer allocations.
+//
+// Within a chunk, the values occupy a contiguous range of slots, which
+// can start anywhere, so that adding and removing at either end of the
+// list is constant time.  Inserting or removing in the middle moves at
+// most half of one chunk's values; a chunk that's full is split in two
+// before inserting into it, and a chunk that becomes less than half
+// full after a removal absorbs the one after it when they'd fit together
+// in half a chunk.
+//
+// Values are moved, not copied, when they're shifted within or between
+// chunks, and those moves are assumed not to throw.  With that
+// assumption, the member functions make the same guarantees that
+// DoublyLinkedList's do.  Like DoublyLinkedList, this doesn't use the
+// C++ Standard Library.
+
+#ifndef UNROLLEDLINKEDLIST_HPP
+#define UNROLLEDLINKEDLIST_HPP
+
+#include "EmptyException.hpp"
+#include "IteratorException.hpp"
+
+
+
+template <typename ValueType, unsigned int ChunkCapacity = 32>
+class UnrolledLinkedList
+{
+    static_assert(ChunkCapacity >= 2, "chunks must be able to hold at least two values");
+
+public:
+    class Iterator;
+    class ConstIterator;
+
+
+private:
+    struct Chunk;
+    struct Position;
+
+
+public:
+    // Initializes this list to be empty.
+    UnrolledLinkedList() noexcept;
+
+    // Initializes this list as a copy of an existing one.
+    UnrolledLinkedList(const UnrolledLinkedList& list);
+
+    // Initializes this list from an expiring one.
+    UnrolledLinkedList(UnrolledLinkedList&& list) noexcept;
+
+
+    // Destroys the contents of this list.
+    virtual ~UnrolledLinkedList() noexcept;
+
+
+    // Replaces the contents of this list with a copy of the contents
+    // of an existing one.
+    UnrolledLinkedList& operator=(const UnrolledLinkedList& list);
+
+    // Replaces the contents of this list with the contents of an
+    // expiring one.
+    UnrolledLinkedList& operator=(UnrolledLinkedList&& list) noexcept;
+
+
+    // addToStart() adds a value to the start of the list, and addToEnd()
+    // adds one to the end of it.
+    void addToStart(const ValueType& value);
+    void addToEnd(const ValueType& value);
+
+
+    // removeFromStart() removes the first value from the list, and
+    // removeFromEnd() removes the last one.  In the event that the list
+    // is empty, an EmptyException will be thrown.
+    void removeFromStart();
+    void removeFromEnd();
+
+
+    // first() and last() return the value at the start or end of the
+    // list.  In the event that the list is empty, an EmptyException will
+    // be thrown.
+    const ValueType& first() const;
+    ValueType& first();
+    const ValueType& last() const;
+    ValueType& last();
+
+
+    // isEmpty() returns true if the list has no values in it, false
+    // otherwise.
+    bool isEmpty() const noexcept;
+
+
+    // size() returns the number of values in the list.
+    unsigned int size() const noexcept;
+
+
+    // iterator() and constIterator() create iterators over this list,
+    // which behave the way DoublyLinkedList's do.  They'll initially be
+    // referring to the first value in the list, unless the list is
+    // empty, in which case they're both "past start" and "past end".
+    Iterator iterator();
+    ConstIterator constIterator() const;
+
+
+public:
+    class IteratorBase
+    {
+    public:
+        // Initializes a newly-constructed IteratorBase to operate on
+        // the given list, referring to its first value.
+        IteratorBase(const UnrolledLinkedList& list) noexcept;
+
+
+        // moveToNext() moves this iterator forward to the next value in
+        // the list, or to the "past end" position after the last one.
+        // If it is already at the "past end" position, an
+        // IteratorException will be thrown.
+        void moveToNext();
+
+
+        // moveToPrevious() moves this iterator backward to the previous
+        // value in the list, or to the "past start" position before the
+        // first one.  If it is already at the "past start" position, an
+        // IteratorException will be thrown.
+        void moveToPrevious();
+
+
+        // isPastStart() and isPastEnd() return true if this iterator is
+        // in the "past start" or "past end" position, false otherwise.
+        bool isPastStart() const noexcept;
+        bool isPastEnd() const noexcept;
+
+    protected:
+        const UnrolledLinkedList * itrList;
+        Chunk * currentChunk;
+        unsigned int currentSlot;
+
+        // When currentChunk is nullptr, the iterator is "past start" if
+        // this is true and "past end" otherwise.
+        bool beforeFirst;
+    };
+
+
+    class ConstIterator : public IteratorBase
+    {
+    public:
+        ConstIterator(const UnrolledLinkedList& list) noexcept;
+
+
+        // value() returns the value that the iterator is currently
+        // referring to.  If the iterator is in the "past start" or
+        // "past end" positions, an IteratorException will be thrown.
+        const ValueType& value() const;
+    };
+
+
+    class Iterator : public IteratorBase
+    {
+    public:
+        Iterator(UnrolledLinkedList& list) noexcept;
+
+
+        // value() returns the value that the iterator is currently
+        // referring to.  If the iterator is in the "past start" or
+        // "past end" positions, an IteratorException will be thrown.
+        ValueType& value() const;
+
+
+        // insertBefore() inserts a new value into the list before the
+        // one to which the iterator currently refers (or at the end of
+        // the list, if the iterator is "past end").  The iterator keeps
+        // referring to the same value.  If the iterator is in the "past
+        // start" position, an IteratorException is thrown.
+        void insertBefore(const ValueType& value);
+
+
+        // insertAfter() inserts a new value into the list after the one
+        // to which the iterator currently refers (or at the start of the
+        // list, if the iterator is "past start").  The iterator keeps
+        // referring to the same value.  If the iterator is in the "past
+        // end" position, an IteratorException is thrown.
+        void insertAfter(const ValueType& value);
+
+
+        // remove() removes the value to which this iterator refers,
+        // moving the iterator to refer to either the value after it
+        // (if moveToNextAfterward is true) or before it (if
+        // moveToNextAfterward is false).  If the iterator is in the
+        // "past start" or "past end" position, an IteratorException
+        // is thrown.
+        void remove(bool moveToNextAfterward = true);
+
+    private:
+        UnrolledLinkedList& baseList;
+
+        void moveTo(const Position& position) noexcept;
+    };
+
+
+private:
+    // Each value is stored in an Element, constructed in place in one of
+    // a chunk's slots, which is what the placement form of operator new
+    // is for.
+    struct Element
+    {
+        ValueType value;
+
+        static void* operator new(decltype(sizeof(0)), void* place) noexcept;
+        static void operator delete(void*, void*) noexcept;
+    };
+
+    struct Slot
+    {
+        alignas(Element) unsigned char storage[sizeof(Element)];
+    };
+
+    // A chunk's values are in slots[begin] through slots[end - 1].
+    struct Chunk
+    {
+        Chunk* prev;
+        Chunk* next;
+        unsigned int begin;
+        unsigned int end;
+        Slot slots[ChunkCapacity];
+    };
+
+    // A position within the list: a slot within a chunk, or the "past
+    // end" position when chunk is nullptr.
+    struct Position
+    {
+        Chunk* chunk;
+        unsigned int slot;
+    };
+
+    Chunk * firstChunk;
+    Chunk * lastChunk;
+    unsigned int listSize;
+
+    // The most recently emptied chunk is kept, rather than deallocated,
+    // so that a list that keeps crossing a chunk boundary (like a queue
+    // whose size stays about the same) doesn't allocate every time.
+    Chunk * spareChunk;
+
+    static ValueType& valueAt(Chunk* chunk, unsigned int slot) noexcept;
+    static void construct(Chunk* chunk, unsigned int slot, const ValueType& value);
+    static void destroy(Chunk* chunk, unsigned int slot) noexcept;
+    static void relocate(Chunk* from, unsigned int fromSlot, Chunk* to, unsigned int toSlot) noexcept;
+
+    Chunk * createChunk(Chunk* prev, Chunk* next, unsigned int begin);
+    void unlinkChunk(Chunk* chunk) noexcept;
+    void splitChunk(Chunk* chunk);
+    void destroyAll() noexcept;
+
+    Position insertAt(Chunk* chunk, unsigned int slot, const ValueType& value);
+    Position removeAt(Chunk* chunk, unsigned int slot) noexcept;
+};
+
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+UnrolledLinkedList<ValueType, ChunkCapacity>::UnrolledLinkedList() noexcept
+{
+    firstChunk = nullptr;
+    lastChunk = nullptr;
+    listSize = 0;
+    spareChunk = nullptr;
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+UnrolledLinkedList<ValueType, ChunkCapacity>::UnrolledLinkedList(const UnrolledLinkedList& list)
+{
+    firstChunk = nullptr;
+    lastChunk = nullptr;
+    listSize = 0;
+    spareChunk = nullptr;
+
+    try {
+        for (Chunk * chunk = list.firstChunk; chunk != nullptr; chunk = chunk->next) {
+            for (unsigned int slot = chunk->begin; slot < chunk->end; ++slot) {
+                addToEnd(valueAt(chunk, slot));
+            }
+        }
+    } catch (...) {
+        destroyAll();
+        throw;
+    }
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+UnrolledLinkedList<ValueType, ChunkCapacity>::UnrolledLinkedList(UnrolledLinkedList&& list) noexcept
+{
+    firstChunk = list.firstChunk;
+    list.firstChunk = nullptr;
+    lastChunk = list.lastChunk;
+    list.lastChunk = nullptr;
+    listSize = list.listSize;
+    list.listSize = 0;
+    spareChunk = list.spareChunk;
+    list.spareChunk = nullptr;
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+UnrolledLinkedList<ValueType, ChunkCapacity>::~UnrolledLinkedList() noexcept
+{
+    destroyAll();
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+UnrolledLinkedList<ValueType, ChunkCapacity>& UnrolledLinkedList<ValueType, ChunkCapacity>::operator=(
+    const UnrolledLinkedList& list)
+{
+    if (this != &list) {
+        UnrolledLinkedList copy{list};
+        *this = static_cast<UnrolledLinkedList&&>(copy);
+    }
+    return *this;
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+UnrolledLinkedList<ValueType, ChunkCapacity>& UnrolledLinkedList<ValueType, ChunkCapacity>::operator=(
+    UnrolledLinkedList&& list) noexcept
+{
+    Chunk * tempChunk = firstChunk;
+    firstChunk = list.firstChunk;
+    list.firstChunk = tempChunk;
+
+    tempChunk = lastChunk;
+    lastChunk = list.lastChunk;
+    list.lastChunk = tempChunk;
+
+    tempChunk = spareChunk;
+    spareChunk = list.spareChunk;
+    list.spareChunk = tempChunk;
+
+    unsigned int tempSize = listSize;
+    listSize = list.listSize;
+    list.listSize = tempSize;
+
+    return *this;
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+void UnrolledLinkedList<ValueType, ChunkCapacity>::addToStart(const ValueType& value)
+{
+    if (firstChunk != nullptr && firstChunk->begin > 0) {
+        construct(firstChunk, firstChunk->begin - 1, value);
+        firstChunk->begin--;
+    } else {
+        //Start a new chunk, filling it from its end so that later values
+        //added to the start go into the same chunk
+        Chunk * chunk = createChunk(nullptr, firstChunk, ChunkCapacity - 1);
+
+        try {
+            construct(chunk, ChunkCapacity - 1, value);
+        } catch (...) {
+            unlinkChunk(chunk);
+            throw;
+        }
+    }
+    listSize++;
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+void UnrolledLinkedList<ValueType, ChunkCapacity>::addToEnd(const ValueType& value)
+{
+    if (lastChunk != nullptr && lastChunk->end < ChunkCapacity) {
+        construct(lastChunk, lastChunk->end, value);
+        lastChunk->end++;
+    } else {
+        Chunk * chunk = createChunk(lastChunk, nullptr, 0);
+
+        try {
+            construct(chunk, 0, value);
+        } catch (...) {
+            unlinkChunk(chunk);
+            throw;
+        }
+    }
+    listSize++;
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+void UnrolledLinkedList<ValueType, ChunkCapacity>::removeFromStart()
+{
+    if (listSize == 0) {
+        throw EmptyException();
+    }
+    removeAt(firstChunk, firstChunk->begin);
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+void UnrolledLinkedList<ValueType, ChunkCapacity>::removeFromEnd()
+{
+    if (listSize == 0) {
+        throw EmptyException();
+    }
+    removeAt(lastChunk, lastChunk->end - 1);
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+const ValueType& UnrolledLinkedList<ValueType, ChunkCapacity>::first() const
+{
+    if (listSize == 0) {
+        throw EmptyException();
+    }
+    return valueAt(firstChunk, firstChunk->begin);
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+ValueType& UnrolledLinkedList<ValueType, ChunkCapacity>::first()
+{
+    if (listSize == 0) {
+        throw EmptyException();
+    }
+    return valueAt(firstChunk, firstChunk->begin);
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+const ValueType& UnrolledLinkedList<ValueType, ChunkCapacity>::last() const
+{
+    if (listSize == 0) {
+        throw EmptyException();
+    }
+    return valueAt(lastChunk, lastChunk->end - 1);
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+ValueType& UnrolledLinkedList<ValueType, ChunkCapacity>::last()
+{
+    if (listSize == 0) {
+        throw EmptyException();
+    }
+    return valueAt(lastChunk, lastChunk->end - 1);
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+bool UnrolledLinkedList<ValueType, ChunkCapacity>::isEmpty() const noexcept
+{
+    return listSize == 0;
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+unsigned int UnrolledLinkedList<ValueType, ChunkCapacity>::size() const noexcept
+{
+    return listSize;
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+typename UnrolledLinkedList<ValueType, ChunkCapacity>::Iterator UnrolledLinkedList<ValueType, ChunkCapacity>::iterator()
+{
+    return Iterator{*this};
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+typename UnrolledLinkedList<ValueType, ChunkCapacity>::ConstIterator UnrolledLinkedList<ValueType, ChunkCapacity>::constIterator() const
+{
+    return ConstIterator{*this};
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+UnrolledLinkedList<ValueType, ChunkCapacity>::IteratorBase::IteratorBase(const UnrolledLinkedList& list) noexcept
+    : itrList{&list}, currentChunk{list.firstChunk}, currentSlot{0}, beforeFirst{true}
+{
+    if (currentChunk != nullptr) {
+        currentSlot = currentChunk->begin;
+    }
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+void UnrolledLinkedList<ValueType, ChunkCapacity>::IteratorBase::moveToNext()
+{
+    if (isPastEnd()) {
+        throw IteratorException();
+    }
+
+    if (currentChunk == nullptr) {
+        //Past start, so the next value is the first one
+        currentChunk = itrList->firstChunk;
+        currentSlot = currentChunk->begin;
+    } else if (currentSlot + 1 < currentChunk->end) {
+        currentSlot++;
+    } else {
+        currentChunk = currentChunk->next;
+        if (currentChunk != nullptr) {
+            currentSlot = currentChunk->begin;
+        } else {
+            beforeFirst = false;
+        }
+    }
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+void UnrolledLinkedList<ValueType, ChunkCapacity>::IteratorBase::moveToPrevious()
+{
+    if (isPastStart()) {
+        throw IteratorException();
+    }
+
+    if (currentChunk == nullptr) {
+        //Past end, so the previous value is the last one
+        currentChunk = itrList->lastChunk;
+        currentSlot = currentChunk->end - 1;
+    } else if (currentSlot > currentChunk->begin) {
+        currentSlot--;
+    } else {
+        currentChunk = currentChunk->prev;
+        if (currentChunk != nullptr) {
+            currentSlot = currentChunk->end - 1;
+        } else {
+            beforeFirst = true;
+        }
+    }
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+bool UnrolledLinkedList<ValueType, ChunkCapacity>::IteratorBase::isPastStart() const noexcept
+{
+    return itrList->listSize == 0 || (currentChunk == nullptr && beforeFirst);
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+bool UnrolledLinkedList<ValueType, ChunkCapacity>::IteratorBase::isPastEnd() const noexcept
+{
+    return itrList->listSize == 0 || (currentChunk == nullptr && !beforeFirst);
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+UnrolledLinkedList<ValueType, ChunkCapacity>::ConstIterator::ConstIterator(const UnrolledLinkedList& list) noexcept
+    : IteratorBase{list}
+{
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+const ValueType& UnrolledLinkedList<ValueType, ChunkCapacity>::ConstIterator::value() const
+{
+    if (this->isPastStart() || this->isPastEnd()) {
+        throw IteratorException();
+    }
+    return valueAt(this->currentChunk, this->currentSlot);
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+UnrolledLinkedList<ValueType, ChunkCapacity>::Iterator::Iterator(UnrolledLinkedList& list) noexcept
+    : IteratorBase{list}, baseList{list}
+{
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+ValueType& UnrolledLinkedList<ValueType, ChunkCapacity>::Iterator::value() const
+{
+    if (this->isPastStart() || this->isPastEnd()) {
+        throw IteratorException();
+    }
+    return valueAt(this->currentChunk, this->currentSlot);
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+void UnrolledLinkedList<ValueType, ChunkCapacity>::Iterator::insertBefore(const ValueType& value)
+{
+    if (this->isPastStart()) {
+        throw IteratorException();
+    } else if (this->currentChunk == nullptr) {
+        baseList.addToEnd(value);
+    } else {
+        //The value this iterator refers to may have moved, but it's now
+        //the one right after the new value
+        moveTo(baseList.insertAt(this->currentChunk, this->currentSlot, value));
+        this->moveToNext();
+    }
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+void UnrolledLinkedList<ValueType, ChunkCapacity>::Iterator::insertAfter(const ValueType& value)
+{
+    if (this->isPastEnd()) {
+        throw IteratorException();
+    } else if (this->currentChunk == nullptr) {
+        baseList.addToStart(value);
+    } else {
+        //The value this iterator refers to may have moved, but it's now
+        //the one right before the new value
+        moveTo(baseList.insertAt(this->currentChunk, this->currentSlot + 1, value));
+        this->moveToPrevious();
+    }
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+void UnrolledLinkedList<ValueType, ChunkCapacity>::Iterator::remove(bool moveToNextAfterward)
+{
+    if (this->isPastStart() || this->isPastEnd()) {
+        throw IteratorException();
+    }
+
+    moveTo(baseList.removeAt(this->currentChunk, this->currentSlot));
+
+    if (!moveToNextAfterward) {
+        if (baseList.listSize == 0) {
+            this->beforeFirst = true;
+        } else {
+            this->moveToPrevious();
+        }
+    }
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+void UnrolledLinkedList<ValueType, ChunkCapacity>::Iterator::moveTo(const Position& position) noexcept
+{
+    this->currentChunk = position.chunk;
+    this->currentSlot = position.slot;
+    this->beforeFirst = false;
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+void* UnrolledLinkedList<ValueType, ChunkCapacity>::Element::operator new(decltype(sizeof(0)), void* place) noexcept
+{
+    return place;
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+void UnrolledLinkedList<ValueType, ChunkCapacity>::Element::operator delete(void*, void*) noexcept
+{
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+ValueType& UnrolledLinkedList<ValueType, ChunkCapacity>::valueAt(Chunk* chunk, unsigned int slot) noexcept
+{
+    return reinterpret_cast<Element*>(chunk->slots[slot].storage)->value;
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+void UnrolledLinkedList<ValueType, ChunkCapacity>::construct(Chunk* chunk, unsigned int slot, const ValueType& value)
+{
+    new (chunk->slots[slot].storage) Element{value};
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+void UnrolledLinkedList<ValueType, ChunkCapacity>::destroy(Chunk* chunk, unsigned int slot) noexcept
+{
+    reinterpret_cast<Element*>(chunk->slots[slot].storage)->~Element();
+}
+
+
+//Moves a value into an empty slot, leaving the slot it came from empty
+template <typename ValueType, unsigned int ChunkCapacity>
+void UnrolledLinkedList<ValueType, ChunkCapacity>::relocate(
+    Chunk* from, unsigned int fromSlot, Chunk* to, unsigned int toSlot) noexcept
+{
+    new (to->slots[toSlot].storage) Element{static_cast<ValueType&&>(valueAt(from, fromSlot))};
+    destroy(from, fromSlot);
+}
+
+
+//Links an empty chunk into the list between prev and next, whose values
+//will start at the given slot
+template <typename ValueType, unsigned int ChunkCapacity>
+typename UnrolledLinkedList<ValueType, ChunkCapacity>::Chunk* UnrolledLinkedList<ValueType, ChunkCapacity>::createChunk(
+    Chunk* prev, Chunk* next, unsigned int begin)
+{
+    Chunk * chunk = spareChunk;
+    if (chunk != nullptr) {
+        spareChunk = nullptr;
+    } else {
+        chunk = new Chunk;
+    }
+
+    chunk->prev = prev;
+    chunk->next = next;
+    chunk->begin = begin;
+    chunk->end = begin + 1;
+
+    if (prev != nullptr) {
+        prev->next = chunk;
+    } else {
+        firstChunk = chunk;
+    }
+
+    if (next != nullptr) {
+        next->prev = chunk;
+    } else {
+        lastChunk = chunk;
+    }
+
+    return chunk;
+}
+
+
+//Unlinks a chunk whose values are already gone, keeping it as the spare
+template <typename ValueType, unsigned int ChunkCapacity>
+void UnrolledLinkedList<ValueType, ChunkCapacity>::unlinkChunk(Chunk* chunk) noexcept
+{
+    if (chunk->prev != nullptr) {
+        chunk->prev->next = chunk->next;
+    } else {
+        firstChunk = chunk->next;
+    }
+
+    if (chunk->next != nullptr) {
+        chunk->next->prev = chunk->prev;
+    } else {
+        lastChunk = chunk->prev;
+    }
+
+    delete spareChunk;
+    spareChunk = chunk;
+}
+
+
+//Moves the second half of a full chunk's values into a new chunk after it
+template <typename ValueType, unsigned int ChunkCapacity>
+void UnrolledLinkedList<ValueType, ChunkCapacity>::splitChunk(Chunk* chunk)
+{
+    const unsigned int half = ChunkCapacity / 2;
+
+    Chunk * newChunk = createChunk(chunk, chunk->next, 0);
+    newChunk->end = 0;
+
+    for (unsigned int slot = half; slot < ChunkCapacity; ++slot) {
+        relocate(chunk, slot, newChunk, newChunk->end);
+        newChunk->end++;
+    }
+
+    chunk->end = half;
+}
+
+
+template <typename ValueType, unsigned int ChunkCapacity>
+void UnrolledLinkedList<ValueType, ChunkCapacity>::destroyAll() noexcept
+{
+    while (firstChunk != nullptr) {
+        Chunk * nextChunk = firstChunk->next;
+        for (unsigned int slot = firstChunk->begin; slot < firstChunk->end; ++slot) {
+            destroy(firstChunk, slot);
+        }
+        delete firstChunk;
+        firstChunk = nextChunk;
+    }
+
+    delete spareChunk;
+    spareChunk = nullptr;
+    lastChunk = nullptr;
+    listSize = 0;
+}
+
+
+//Inserts a value before the one in the given slot of a chunk (or after the
+//chunk's last value, if the slot is the chunk's end), returning where the
+//new value ended up.  The value is copied before anything is moved, so a
+//failed copy leaves the list as it was.
+template <typename ValueType, unsigned int ChunkCapacity>
+typename UnrolledLinkedList<ValueType, ChunkCapacity>::Position UnrolledLinkedList<ValueType, ChunkCapacity>::insertAt(
+    Chunk* chunk, unsigned int slot, const ValueType& value)
+{
+    ValueType copy{value};
+
+    if (chunk->begin == 0 && chunk->end == ChunkCapacity) {
+        splitChunk(chunk);
+
+        if (slot > chunk->end) {
+            slot -= chunk->end;
+            chunk = chunk->next;
+        }
+    }
+
+    if (chunk->end < ChunkCapacity) {
+        //Make room by moving the values from the slot onward toward the end
+        for (unsigned int i = chunk->end; i > slot; --i) {
+            relocate(chunk, i - 1, chunk, i);
+        }
+        chunk->end++;
+    } else {
+        //Make room by moving the values before the slot toward the start
+        for (unsigned int i = chunk->begin; i < slot; ++i) {
+            relocate(chunk, i, chunk, i - 1);
+        }
+        chunk->begin--;
+        slot--;
+    }
+
+    new (chunk->slots[slot].storage) Element{static_cast<ValueType&&>(copy)};
+    listSize++;
+
+    return Position{chunk, slot};
+}
+
+
+//Removes the value in the given slot of a chunk, returning the position
+//of the value that followed it
+template <typename ValueType, unsigned int ChunkCapacity>
+typename UnrolledLinkedList<ValueType, ChunkCapacity>::Position UnrolledLinkedList<ValueType, ChunkCapacity>::removeAt(
+    Chunk* chunk, unsigned int slot) noexcept
+{
+    destroy(chunk, slot);
+    listSize--;
+
+    Position following{chunk, slot + 1};
+
+    if (slot == chunk->begin) {
+        chunk->begin++;
+    } else if (slot + 1 == chunk->end) {
+        chunk->end--;
+        following.slot = chunk->end;
+    } else if (slot - chunk->begin < chunk->end - slot - 1) {
+        //Fewer values before the slot than after, so move those
+        for (unsigned int i = slot; i > chunk->begin; --i) {
+            relocate(chunk, i - 1, chunk, i);
+        }
+        chunk->begin++;
+    } else {
+        for (unsigned int i = slot; i + 1 < chunk->end; ++i) {
+            relocate(chunk, i + 1, chunk, i);
+        }
+        chunk->end--;
+        following.slot = slot;
+    }
+
+    if (chunk->begin == chunk->end) {
+        following = Position{chunk->next, chunk->next != nullptr ? chunk->next->begin : 0};
+        unlinkChunk(chunk);
+        return following;
+    }
+
+    if (following.slot == chunk->end) {
+        following = Position{chunk->next, chunk->next != nullptr ? chunk->next->begin : 0};
+    }
+
+    //Absorb the next chunk when both would fit together in half a chunk,
+    //so that removals don't leave behind lots of nearly empty chunks
+    Chunk * next = chunk->next;
+    if (next != nullptr
+        && (chunk->end - chunk->begin) + (next->end - next->begin) <= ChunkCapacity / 2) {
+        if (chunk->end + (next->end - next->begin) > ChunkCapacity) {
+            unsigned int shift = chunk->begin;
+            for (unsigned int i = chunk->begin; i < chunk->end; ++i) {
+                relocate(chunk, i, chunk, i - shift);
+            }
+            chunk->begin -= shift;
+            chunk->end -= shift;
+
+            if (following.chunk == chunk) {
+                following.slot -= shift;
+            }
+        }
+
+        if (following.chunk == next) {
+            following = Position{chunk, chunk->end + (following.slot - next->begin)};
+        }
+
+        for (unsigned int i = next->begin; i < next->end; ++i) {
+            relocate(next, i, chunk, chunk->end);
+            chunk->end++;
+        }
+        next->begin = next->end;
+        unlinkChunk(next);
+    }
+
+    return following;
+}
+
+
+
+#endif
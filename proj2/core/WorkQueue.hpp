@@ -0,0 +1,318 @@
+// WorkQueue.hpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// WorkQueue<ValueType> is a bounded queue that any number of threads can
+// enqueue into and dequeue from at the same time.  Its values are kept
+// in a RingQueue, guarded by a mutex, with condition variables that let
+// threads wait for room (when the queue is full) or for a value (when
+// it's empty).
+//
+// Because another thread can change the queue between any two calls, a
+// WorkQueue doesn't have Queue's front(); dequeue() hands back the value
+// it removes instead.  Producers and consumers that handle many values
+// at once can use enqueueRange() and dequeueN(), which lock the queue
+// once per batch instead of once per value.
+//
+// When there's nothing left to add, close() the queue.  After that,
+// enqueuing throws a ClosedException, while consumers can keep
+// dequeuing until the queue has been drained; dequeue() then returns
+// false instead of waiting, so a consumer's loop can simply be:
+//
+//     while (queue.dequeue(value)) { ... }
+//
+// Unlike the rest of the project's queues, this uses the C++ Standard
+// Library, for its mutex and condition variables.
+
+#ifndef WORKQUEUE_HPP
+#define WORKQUEUE_HPP
+
+#include <condition_variable>
+#include <mutex>
+#include "CapacityException.hpp"
+#include "ClosedException.hpp"
+#include "RingQueue.hpp"
+
+
+
+template <typename ValueType>
+class WorkQueue
+{
+public:
+    // Initializes an empty, open queue that will hold at most the given
+    // number of values.  A capacity of zero throws a CapacityException,
+    // since every enqueue() into such a queue would wait forever.
+    explicit WorkQueue(unsigned int capacity);
+
+    WorkQueue(const WorkQueue&) = delete;
+    WorkQueue& operator=(const WorkQueue&) = delete;
+
+
+    // enqueue() adds a value to the back of the queue, waiting for room
+    // if the queue is full.  If the queue is closed (including while
+    // waiting), it throws a ClosedException instead.
+    void enqueue(const ValueType& value);
+    void enqueue(ValueType&& value);
+
+    // tryEnqueue() adds a value to the back of the queue and returns
+    // true, or returns false without doing anything if the queue is
+    // full or closed.
+    bool tryEnqueue(const ValueType& value);
+
+    // enqueueRange() adds copies of count values, starting with the one
+    // that values points to, to the back of the queue, in order, waiting
+    // for room as needed.  Values are added as room becomes available,
+    // so consumers may see part of a batch before the rest is added.  If
+    // the queue is closed before all of them have been added, it throws
+    // a ClosedException.
+    void enqueueRange(const ValueType* values, unsigned int count);
+
+
+    // dequeue() moves the front value out of the queue into the given
+    // variable, waiting for one if the queue is empty, and returns true.
+    // Once the queue is closed and empty, it returns false instead.
+    bool dequeue(ValueType& value);
+
+    // tryDequeue() moves the front value out of the queue into the given
+    // variable and returns true, or returns false without waiting if
+    // the queue is empty.
+    bool tryDequeue(ValueType& value);
+
+    // dequeueN() waits until the queue has at least one value (or is
+    // closed and empty), then moves up to count values out of it into
+    // the array that values points to and returns how many there were.
+    // It returns zero only once the queue is closed and empty.
+    unsigned int dequeueN(ValueType* values, unsigned int count);
+
+
+    // close() closes the queue, waking any threads that are waiting on
+    // it.  Closing a queue that's already closed has no effect.
+    void close();
+
+    // isClosed() returns true if the queue has been closed.
+    bool isClosed() const;
+
+    // isEmpty() and size() describe the queue as it was at some moment
+    // during the call; by the time they return, other threads may have
+    // changed it.
+    bool isEmpty() const;
+    unsigned int size() const;
+
+    // capacity() returns the most values the queue will hold.
+    unsigned int capacity() const noexcept;
+
+
+private:
+    mutable std::mutex mutex;
+    std::condition_variable notFull;
+    std::condition_variable notEmpty;
+
+    RingQueue<ValueType> values;
+    unsigned int maxSize;
+    bool closed;
+
+    void waitForRoom(std::unique_lock<std::mutex>& lock);
+    bool waitForValue(std::unique_lock<std::mutex>& lock);
+};
+
+
+
+template <typename ValueType>
+WorkQueue<ValueType>::WorkQueue(unsigned int capacity)
+    : maxSize{capacity}, closed{false}
+{
+    if (capacity == 0) {
+        throw CapacityException{};
+    }
+
+    values.reserve(capacity);
+}
+
+
+template <typename ValueType>
+void WorkQueue<ValueType>::enqueue(const ValueType& value)
+{
+    std::unique_lock<std::mutex> lock{mutex};
+    waitForRoom(lock);
+    values.enqueue(value);
+    lock.unlock();
+
+    notEmpty.notify_one();
+}
+
+
+template <typename ValueType>
+void WorkQueue<ValueType>::enqueue(ValueType&& value)
+{
+    std::unique_lock<std::mutex> lock{mutex};
+    waitForRoom(lock);
+    values.enqueue(static_cast<ValueType&&>(value));
+    lock.unlock();
+
+    notEmpty.notify_one();
+}
+
+
+template <typename ValueType>
+bool WorkQueue<ValueType>::tryEnqueue(const ValueType& value)
+{
+    std::unique_lock<std::mutex> lock{mutex};
+    if (closed || values.size() >= maxSize) {
+        return false;
+    }
+
+    values.enqueue(value);
+    lock.unlock();
+
+    notEmpty.notify_one();
+    return true;
+}
+
+
+template <typename ValueType>
+void WorkQueue<ValueType>::enqueueRange(const ValueType* newValues, unsigned int count)
+{
+    while (count > 0) {
+        std::unique_lock<std::mutex> lock{mutex};
+        waitForRoom(lock);
+
+        unsigned int room = maxSize - values.size();
+        unsigned int batch = count < room ? count : room;
+        values.enqueueRange(newValues, batch);
+        lock.unlock();
+
+        if (batch > 1) {
+            notEmpty.notify_all();
+        } else {
+            notEmpty.notify_one();
+        }
+
+        newValues += batch;
+        count -= batch;
+    }
+}
+
+
+template <typename ValueType>
+bool WorkQueue<ValueType>::dequeue(ValueType& value)
+{
+    std::unique_lock<std::mutex> lock{mutex};
+    if (!waitForValue(lock)) {
+        return false;
+    }
+
+    values.dequeueN(&value, 1);
+    lock.unlock();
+
+    notFull.notify_one();
+    return true;
+}
+
+
+template <typename ValueType>
+bool WorkQueue<ValueType>::tryDequeue(ValueType& value)
+{
+    std::unique_lock<std::mutex> lock{mutex};
+    if (values.isEmpty()) {
+        return false;
+    }
+
+    values.dequeueN(&value, 1);
+    lock.unlock();
+
+    notFull.notify_one();
+    return true;
+}
+
+
+template <typename ValueType>
+unsigned int WorkQueue<ValueType>::dequeueN(ValueType* outValues, unsigned int count)
+{
+    std::unique_lock<std::mutex> lock{mutex};
+    if (count == 0 || !waitForValue(lock)) {
+        return 0;
+    }
+
+    unsigned int dequeued = values.dequeueN(outValues, count);
+    lock.unlock();
+
+    if (dequeued > 1) {
+        notFull.notify_all();
+    } else {
+        notFull.notify_one();
+    }
+
+    return dequeued;
+}
+
+
+template <typename ValueType>
+void WorkQueue<ValueType>::close()
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        closed = true;
+    }
+
+    notFull.notify_all();
+    notEmpty.notify_all();
+}
+
+
+template <typename ValueType>
+bool WorkQueue<ValueType>::isClosed() const
+{
+    std::lock_guard<std::mutex> lock{mutex};
+    return closed;
+}
+
+
+template <typename ValueType>
+bool WorkQueue<ValueType>::isEmpty() const
+{
+    std::lock_guard<std::mutex> lock{mutex};
+    return values.isEmpty();
+}
+
+
+template <typename ValueType>
+unsigned int WorkQueue<ValueType>::size() const
+{
+    std::lock_guard<std::mutex> lock{mutex};
+    return values.size();
+}
+
+
+template <typename ValueType>
+unsigned int WorkQueue<ValueType>::capacity() const noexcept
+{
+    return maxSize;
+}
+
+
+//Waits, with the lock held, until the queue has room for another value,
+//throwing a ClosedException if it's closed first
+template <typename ValueType>
+void WorkQueue<ValueType>::waitForRoom(std::unique_lock<std::mutex>& lock)
+{
+    notFull.wait(lock, [this]() { return closed || values.size() < maxSize; });
+
+    if (closed) {
+        throw ClosedException{};
+    }
+}
+
+
+//Waits, with the lock held, until the queue has a value, returning false
+//if it's closed and empty instead
+template <typename ValueType>
+bool WorkQueue<ValueType>::waitForValue(std::unique_lock<std::mutex>& lock)
+{
+    notEmpty.wait(lock, [this]() { return closed || !values.isEmpty(); });
+    return !values.isEmpty();
+}
+
+
+
+#endif
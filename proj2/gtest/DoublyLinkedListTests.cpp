@@ -0,0 +1,471 @@
+// DoublyLinkedListTests.cpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// Unit tests for the parts of DoublyLinkedList<ValueType> that go
+// beyond the sanity checks: how it manages the memory for its nodes, and
+// how it moves and reorders them without copying their values.
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include "DoublyLinkedList.hpp"
+
+
+namespace
+{
+    struct ThrowsWhenCopied
+    {
+        bool throwOnCopy;
+
+        ThrowsWhenCopied(bool throwOnCopy)
+            : throwOnCopy{throwOnCopy}
+        {
+        }
+
+        ThrowsWhenCopied(const ThrowsWhenCopied& other)
+            : throwOnCopy{other.throwOnCopy}
+        {
+            if (throwOnCopy)
+            {
+                throw 0;
+            }
+        }
+    };
+
+
+    // Counts how many times values of this type are copied and moved
+    struct Tracked
+    {
+        static int copies;
+        static int moves;
+
+        std::string text;
+        int number;
+
+        Tracked(std::string text, int number)
+            : text{std::move(text)}, number{number}
+        {
+        }
+
+        Tracked(const Tracked& other)
+            : text{other.text}, number{other.number}
+        {
+            ++copies;
+        }
+
+        Tracked(Tracked&& other) noexcept
+            : text{std::move(other.text)}, number{other.number}
+        {
+            ++moves;
+        }
+
+        static void reset()
+        {
+            copies = 0;
+            moves = 0;
+        }
+    };
+
+    int Tracked::copies = 0;
+    int Tracked::moves = 0;
+
+
+    template <typename ValueType>
+    std::vector<ValueType> valuesIn(const DoublyLinkedList<ValueType>& list)
+    {
+        std::vector<ValueType> values;
+        for (auto i = list.constIterator(); !i.isPastEnd(); i.moveToNext())
+        {
+            values.push_back(i.value());
+        }
+
+        return values;
+    }
+
+
+    template <typename ValueType>
+    DoublyLinkedList<ValueType> listOf(const std::vector<ValueType>& values)
+    {
+        DoublyLinkedList<ValueType> list;
+        for (const ValueType& value : values)
+        {
+            list.addToEnd(value);
+        }
+
+        return list;
+    }
+}
+
+
+TEST(DoublyLinkedListTests, removedNodesAreReusedByLaterAdds)
+{
+    DoublyLinkedList<int> list;
+    list.addToEnd(10);
+    const int* firstValue = &list.first();
+
+    list.removeFromStart();
+    list.addToEnd(20);
+
+    EXPECT_EQ(firstValue, &list.first());
+    EXPECT_EQ(20, list.first());
+}
+
+
+TEST(DoublyLinkedListTests, queueLikeChurnKeepsReusingTheSameNodes)
+{
+    DoublyLinkedList<std::string> list;
+    list.addToEnd("Boo");
+    list.addToEnd("is");
+
+    const std::string* first = &list.first();
+    const std::string* second = &list.last();
+
+    for (unsigned int i = 0; i < 1000; ++i)
+    {
+        std::string value = list.first();
+        list.removeFromStart();
+        list.addToEnd(value);
+
+        EXPECT_TRUE(&list.last() == first || &list.last() == second);
+    }
+
+    EXPECT_EQ(2, list.size());
+    EXPECT_EQ("Boo", list.first());
+    EXPECT_EQ("is", list.last());
+}
+
+
+TEST(DoublyLinkedListTests, failingToCopyAValueLeavesTheListUnchanged)
+{
+    DoublyLinkedList<ThrowsWhenCopied> list;
+    list.addToEnd(ThrowsWhenCopied{false});
+
+    EXPECT_ANY_THROW(list.addToEnd(ThrowsWhenCopied{true}));
+    EXPECT_EQ(1, list.size());
+    EXPECT_FALSE(list.last().throwOnCopy);
+
+    list.addToStart(ThrowsWhenCopied{false});
+    EXPECT_EQ(2, list.size());
+}
+
+
+TEST(DoublyLinkedListTests, movedFromListsCanBeReused)
+{
+    DoublyLinkedList<int> list;
+    list.addToEnd(10);
+    list.removeFromEnd();
+    list.addToEnd(20);
+
+    DoublyLinkedList<int> moved{std::move(list)};
+    EXPECT_EQ(20, moved.first());
+
+    list.addToEnd(30);
+    EXPECT_EQ(30, list.first());
+    EXPECT_EQ(1, moved.size());
+}
+
+
+TEST(DoublyLinkedListTests, splicingMovesEveryNodeBeforeTheIterator)
+{
+    DoublyLinkedList<int> list = listOf<int>({1, 2, 5});
+    DoublyLinkedList<int> other = listOf<int>({3, 4});
+    const int* three = &other.first();
+
+    DoublyLinkedList<int>::Iterator i = list.iterator();
+    i.moveToNext();
+    i.moveToNext();
+    list.splice(i, other);
+
+    EXPECT_EQ((std::vector<int>{1, 2, 3, 4, 5}), valuesIn(list));
+    EXPECT_EQ(5, list.size());
+    EXPECT_EQ(5, i.value());
+    EXPECT_TRUE(other.isEmpty());
+
+    i.moveToPrevious();
+    i.moveToPrevious();
+    EXPECT_EQ(three, &i.value());
+}
+
+
+TEST(DoublyLinkedListTests, splicingAtEitherEndOrIntoAnEmptyListWorks)
+{
+    DoublyLinkedList<int> list;
+    DoublyLinkedList<int> middle = listOf<int>({2, 3});
+    DoublyLinkedList<int> start = listOf<int>({1});
+    DoublyLinkedList<int> end = listOf<int>({4, 5});
+
+    DoublyLinkedList<int>::Iterator i = list.iterator();
+    list.splice(i, middle);
+    EXPECT_EQ((std::vector<int>{2, 3}), valuesIn(list));
+
+    DoublyLinkedList<int>::Iterator j = list.iterator();
+    list.splice(j, start);
+    EXPECT_EQ(1, list.first());
+
+    DoublyLinkedList<int>::Iterator k = list.iterator();
+    while (!k.isPastEnd())
+    {
+        k.moveToNext();
+    }
+    list.splice(k, end);
+
+    EXPECT_EQ((std::vector<int>{1, 2, 3, 4, 5}), valuesIn(list));
+    EXPECT_EQ(5, list.last());
+
+    list.removeFromEnd();
+    list.removeFromStart();
+    EXPECT_EQ((std::vector<int>{2, 3, 4}), valuesIn(list));
+}
+
+
+TEST(DoublyLinkedListTests, splicingRequiresAnIteratorOverTheList)
+{
+    DoublyLinkedList<int> list = listOf<int>({1});
+    DoublyLinkedList<int> other = listOf<int>({2});
+
+    DoublyLinkedList<int>::Iterator i = other.iterator();
+    EXPECT_THROW(list.splice(i, other), IteratorException);
+    EXPECT_THROW(list.splitAt(i), IteratorException);
+}
+
+
+TEST(DoublyLinkedListTests, splittingMovesTheIteratorsValueAndTheRest)
+{
+    DoublyLinkedList<int> list = listOf<int>({1, 2, 3, 4, 5});
+
+    DoublyLinkedList<int>::Iterator i = list.iterator();
+    i.moveToNext();
+    i.moveToNext();
+    DoublyLinkedList<int> rest = list.splitAt(i);
+
+    EXPECT_EQ((std::vector<int>{1, 2}), valuesIn(list));
+    EXPECT_EQ(2, list.size());
+    EXPECT_EQ(2, list.last());
+    EXPECT_TRUE(i.isPastEnd());
+
+    EXPECT_EQ((std::vector<int>{3, 4, 5}), valuesIn(rest));
+    EXPECT_EQ(3, rest.size());
+    EXPECT_EQ(3, rest.first());
+
+    DoublyLinkedList<int>::Iterator j = list.iterator();
+    list.splice(j, rest);
+    EXPECT_EQ((std::vector<int>{3, 4, 5, 1, 2}), valuesIn(list));
+}
+
+
+TEST(DoublyLinkedListTests, splittingAtTheStartOrPastTheEnd)
+{
+    DoublyLinkedList<int> list = listOf<int>({1, 2, 3});
+
+    DoublyLinkedList<int>::Iterator i = list.iterator();
+    DoublyLinkedList<int> all = list.splitAt(i);
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_EQ(3, all.size());
+
+    DoublyLinkedList<int>::Iterator j = all.iterator();
+    while (!j.isPastEnd())
+    {
+        j.moveToNext();
+    }
+    DoublyLinkedList<int> none = all.splitAt(j);
+    EXPECT_TRUE(none.isEmpty());
+    EXPECT_EQ((std::vector<int>{1, 2, 3}), valuesIn(all));
+}
+
+
+TEST(DoublyLinkedListTests, splitNodesCanBeRemovedAndReusedByEitherList)
+{
+    DoublyLinkedList<std::string> list = listOf<std::string>({"a", "b", "c", "d"});
+
+    DoublyLinkedList<std::string>::Iterator i = list.iterator();
+    i.moveToNext();
+    DoublyLinkedList<std::string> rest = list.splitAt(i);
+
+    rest.removeFromStart();
+    rest.addToEnd("e");
+    list.removeFromEnd();
+    list.addToStart("z");
+
+    EXPECT_EQ((std::vector<std::string>{"z"}), valuesIn(list));
+    EXPECT_EQ((std::vector<std::string>{"c", "d", "e"}), valuesIn(rest));
+}
+
+
+TEST(DoublyLinkedListTests, sortingIsStableAndRelinksBothDirections)
+{
+    using Pair = std::pair<int, int>;
+    std::vector<Pair> values;
+    std::mt19937 random{46};
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        values.emplace_back(random() % 50, i);
+    }
+
+    DoublyLinkedList<Pair> list = listOf(values);
+    list.sort([](const Pair& a, const Pair& b) { return a.first < b.first; });
+
+    std::stable_sort(
+        values.begin(), values.end(),
+        [](const Pair& a, const Pair& b) { return a.first < b.first; });
+
+    EXPECT_EQ(values, valuesIn(list));
+    EXPECT_EQ(values.front(), list.first());
+    EXPECT_EQ(values.back(), list.last());
+
+    //Walking backward checks the prev pointers, too
+    std::vector<Pair> backward;
+    auto i = list.iterator();
+    for (unsigned int n = 1; n < list.size(); ++n)
+    {
+        i.moveToNext();
+    }
+    for (; !i.isPastStart(); i.moveToPrevious())
+    {
+        backward.push_back(i.value());
+    }
+    std::reverse(backward.begin(), backward.end());
+    EXPECT_EQ(values, backward);
+}
+
+
+TEST(DoublyLinkedListTests, sortingSmallListsUsesLessThan)
+{
+    DoublyLinkedList<int> empty;
+    empty.sort();
+    EXPECT_TRUE(empty.isEmpty());
+
+    DoublyLinkedList<int> one = listOf<int>({7});
+    one.sort();
+    EXPECT_EQ((std::vector<int>{7}), valuesIn(one));
+
+    DoublyLinkedList<int> some = listOf<int>({5, 3, 9, 1, 3});
+    some.sort();
+    EXPECT_EQ((std::vector<int>{1, 3, 3, 5, 9}), valuesIn(some));
+}
+
+
+TEST(DoublyLinkedListTests, mergingInterleavesSortedLists)
+{
+    DoublyLinkedList<int> list = listOf<int>({1, 4, 4, 9});
+    DoublyLinkedList<int> other = listOf<int>({0, 4, 10});
+    auto j = other.iterator();
+    j.moveToNext();
+    const int* otherFour = &j.value();
+
+    list.merge(other);
+
+    EXPECT_EQ((std::vector<int>{0, 1, 4, 4, 4, 9, 10}), valuesIn(list));
+    EXPECT_EQ(7, list.size());
+    EXPECT_EQ(10, list.last());
+    EXPECT_TRUE(other.isEmpty());
+
+    auto i = list.iterator();
+    for (int n = 0; n < 4; ++n)
+    {
+        i.moveToNext();
+    }
+    EXPECT_EQ(otherFour, &i.value());
+}
+
+
+TEST(DoublyLinkedListTests, failingComparisonsLeaveEveryValueInTheList)
+{
+    DoublyLinkedList<int> list = listOf<int>({5, 4, 3, 2, 1, 0});
+    int comparisons = 0;
+
+    EXPECT_THROW(
+        list.sort(
+            [&comparisons](int a, int b)
+            {
+                if (++comparisons == 4)
+                {
+                    throw 0;
+                }
+                return a < b;
+            }),
+        int);
+
+    EXPECT_EQ(6, list.size());
+    std::vector<int> values = valuesIn(list);
+    std::sort(values.begin(), values.end());
+    EXPECT_EQ((std::vector<int>{0, 1, 2, 3, 4, 5}), values);
+
+    list.sort();
+    EXPECT_EQ((std::vector<int>{0, 1, 2, 3, 4, 5}), valuesIn(list));
+    EXPECT_EQ(5, list.last());
+}
+
+
+TEST(DoublyLinkedListTests, emplacingConstructsValuesInPlace)
+{
+    DoublyLinkedList<Tracked> list;
+    Tracked::reset();
+
+    list.emplaceBack("middle", 2);
+    list.emplaceFront("first", 1);
+    list.emplaceBack("last", 4);
+
+    DoublyLinkedList<Tracked>::Iterator i = list.iterator();
+    i.moveToNext();
+    i.emplaceAfter("third", 3);
+    i.emplaceBefore(std::string(10, 'x'), 0);
+
+    EXPECT_EQ(0, Tracked::copies);
+    EXPECT_EQ(0, Tracked::moves);
+
+    std::vector<int> numbers;
+    for (auto j = list.constIterator(); !j.isPastEnd(); j.moveToNext())
+    {
+        numbers.push_back(j.value().number);
+    }
+    EXPECT_EQ((std::vector<int>{1, 0, 2, 3, 4}), numbers);
+    EXPECT_EQ(5, list.size());
+}
+
+
+TEST(DoublyLinkedListTests, expiringValuesAreMovedRatherThanCopied)
+{
+    DoublyLinkedList<Tracked> list;
+    Tracked::reset();
+
+    Tracked value{"abcdefghijklmnopqrstuvwxyz", 1};
+    list.addToEnd(std::move(value));
+    list.addToStart(Tracked{"b", 2});
+
+    DoublyLinkedList<Tracked>::Iterator i = list.iterator();
+    i.insertAfter(Tracked{"c", 3});
+    i.insertBefore(Tracked{"d", 4});
+
+    EXPECT_EQ(0, Tracked::copies);
+    EXPECT_EQ(4, Tracked::moves);
+    EXPECT_EQ("abcdefghijklmnopqrstuvwxyz", list.last().text);
+
+    const Tracked& first = list.first();
+    list.addToEnd(first);
+    EXPECT_EQ(1, Tracked::copies);
+    EXPECT_EQ(4, list.first().number);
+    EXPECT_EQ(4, list.last().number);
+}
+
+
+TEST(DoublyLinkedListTests, emplacingAValueFromTheListItselfIsSafe)
+{
+    DoublyLinkedList<std::string> list;
+    list.emplaceBack(3, 'a');
+
+    for (int i = 0; i < 5; ++i)
+    {
+        list.emplaceBack(list.last() + "b");
+        list.emplaceFront(list.first());
+    }
+
+    EXPECT_EQ(11, list.size());
+    EXPECT_EQ("aaabbbbb", list.last());
+    EXPECT_EQ("aaa", list.first());
+}
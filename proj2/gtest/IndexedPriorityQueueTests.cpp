@@ -0,0 +1,196 @@
+// IndexedPriorityQueueTests.cpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// Unit tests for IndexedPriorityQueue<PriorityType>.
+
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include "IndexedPriorityQueue.hpp"
+
+
+TEST(IndexedPriorityQueueTests, keysComeOutInPriorityOrder)
+{
+    IndexedPriorityQueue<int> q{5};
+    q.enqueue(0, 50);
+    q.enqueue(1, 10);
+    q.enqueue(2, 40);
+    q.enqueue(3, 20);
+    q.enqueue(4, 30);
+
+    std::vector<unsigned int> keys;
+    while (!q.isEmpty())
+    {
+        keys.push_back(q.front());
+        q.dequeue();
+    }
+
+    EXPECT_EQ((std::vector<unsigned int>{1, 3, 4, 2, 0}), keys);
+}
+
+
+TEST(IndexedPriorityQueueTests, tiesGoToTheLowerKey)
+{
+    IndexedPriorityQueue<int> q{4};
+    q.enqueue(3, 7);
+    q.enqueue(1, 7);
+    q.enqueue(2, 7);
+
+    EXPECT_EQ(1, q.front());
+    q.dequeue();
+    EXPECT_EQ(2, q.front());
+    q.dequeue();
+    EXPECT_EQ(3, q.front());
+}
+
+
+TEST(IndexedPriorityQueueTests, prioritiesCanBeChangedInPlace)
+{
+    IndexedPriorityQueue<int> q{3};
+    q.enqueue(0, 10);
+    q.enqueue(1, 20);
+    q.enqueue(2, 30);
+
+    q.changePriority(2, 5);
+    EXPECT_EQ(2, q.front());
+    EXPECT_EQ(5, q.frontPriority());
+
+    q.changePriority(2, 25);
+    EXPECT_EQ(0, q.front());
+    EXPECT_EQ(25, q.priorityOf(2));
+
+    EXPECT_FALSE(q.decreasePriority(1, 21));
+    EXPECT_EQ(20, q.priorityOf(1));
+    EXPECT_TRUE(q.decreasePriority(1, 1));
+    EXPECT_EQ(1, q.front());
+    EXPECT_EQ(3, q.size());
+}
+
+
+TEST(IndexedPriorityQueueTests, keysCanBeRemovedFromAnywhere)
+{
+    IndexedPriorityQueue<int> q{4};
+    q.enqueue(0, 1);
+    q.enqueue(1, 2);
+    q.enqueue(2, 3);
+    q.enqueue(3, 4);
+
+    q.remove(1);
+    EXPECT_FALSE(q.contains(1));
+    EXPECT_EQ(3, q.size());
+
+    q.remove(0);
+    EXPECT_EQ(2, q.front());
+
+    q.enqueue(1, 0);
+    EXPECT_EQ(1, q.front());
+}
+
+
+TEST(IndexedPriorityQueueTests, badKeysAndEmptyQueuesThrow)
+{
+    IndexedPriorityQueue<int> q{2};
+
+    EXPECT_THROW(q.front(), EmptyException);
+    EXPECT_THROW(q.frontPriority(), EmptyException);
+    EXPECT_THROW(q.dequeue(), EmptyException);
+
+    EXPECT_THROW(q.enqueue(2, 0), KeyException);
+    q.enqueue(1, 0);
+    EXPECT_THROW(q.enqueue(1, 5), KeyException);
+
+    EXPECT_THROW(q.remove(0), KeyException);
+    EXPECT_THROW(q.changePriority(0, 1), KeyException);
+    EXPECT_THROW(q.decreasePriority(0, 1), KeyException);
+    EXPECT_THROW(q.priorityOf(7), KeyException);
+    EXPECT_FALSE(q.contains(7));
+}
+
+
+TEST(IndexedPriorityQueueTests, copiesAreIndependent)
+{
+    IndexedPriorityQueue<int> q{3};
+    q.enqueue(0, 3);
+    q.enqueue(1, 2);
+
+    IndexedPriorityQueue<int> copy{q};
+    copy.changePriority(0, 1);
+    copy.enqueue(2, 0);
+
+    EXPECT_EQ(1, q.front());
+    EXPECT_EQ(2, q.size());
+    EXPECT_EQ(2, copy.front());
+
+    q = copy;
+    EXPECT_EQ(3, q.size());
+    EXPECT_EQ(1, q.priorityOf(0));
+
+    IndexedPriorityQueue<int> moved{std::move(copy)};
+    EXPECT_EQ(2, moved.front());
+    EXPECT_TRUE(copy.isEmpty());
+}
+
+
+TEST(IndexedPriorityQueueTests, randomOperationsMatchAnOrderedSet)
+{
+    constexpr unsigned int keyCount = 200;
+    IndexedPriorityQueue<int> q{keyCount};
+    std::set<std::pair<int, unsigned int>> expected;
+    std::vector<int> priorities(keyCount);
+    std::mt19937 random{46};
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        unsigned int key = random() % keyCount;
+        int priority = random() % 1000;
+
+        switch (random() % 4)
+        {
+        case 0:
+            if (!q.contains(key))
+            {
+                q.enqueue(key, priority);
+                expected.emplace(priority, key);
+                priorities[key] = priority;
+            }
+            break;
+
+        case 1:
+            if (q.contains(key))
+            {
+                q.changePriority(key, priority);
+                expected.erase({priorities[key], key});
+                expected.emplace(priority, key);
+                priorities[key] = priority;
+            }
+            break;
+
+        case 2:
+            if (q.contains(key))
+            {
+                q.remove(key);
+                expected.erase({priorities[key], key});
+            }
+            break;
+
+        case 3:
+            if (!q.isEmpty())
+            {
+                q.dequeue();
+                expected.erase(expected.begin());
+            }
+            break;
+        }
+
+        ASSERT_EQ(expected.size(), q.size());
+        if (!expected.empty())
+        {
+            ASSERT_EQ(expected.begin()->second, q.front());
+            ASSERT_EQ(expected.begin()->first, q.frontPriority());
+        }
+    }
+}
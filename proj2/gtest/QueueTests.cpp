@@ -0,0 +1,45 @@
+// QueueTests.cpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// Unit tests for the parts of Queue<ValueType> that go beyond the sanity
+// checks: adding values without copying them.
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include "Queue.hpp"
+
+
+TEST(QueueTests, valuesThatCanOnlyBeMovedCanBeEnqueued)
+{
+    Queue<std::unique_ptr<int>> q;
+    q.enqueue(std::make_unique<int>(1));
+    q.enqueue(std::make_unique<int>(2));
+
+    EXPECT_EQ(2, q.size());
+    EXPECT_EQ(1, *q.front());
+    q.dequeue();
+    EXPECT_EQ(2, *q.front());
+}
+
+
+TEST(QueueTests, emplacedValuesAreConstructedFromTheirArguments)
+{
+    Queue<std::vector<int>> q;
+    q.emplace(3, 46);
+    q.emplace();
+
+    std::vector<int> values{1, 2, 3};
+    const int* data = values.data();
+    q.enqueue(std::move(values));
+
+    EXPECT_EQ((std::vector<int>{46, 46, 46}), q.front());
+    q.dequeue();
+    EXPECT_TRUE(q.front().empty());
+    q.dequeue();
+    EXPECT_EQ(data, q.front().data());
+}
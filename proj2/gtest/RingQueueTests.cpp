@@ -0,0 +1,252 @@
+// RingQueueTests.cpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// Unit tests for RingQueue<ValueType>.
+
+#include <memory>
+#include <string>
+#include <gtest/gtest.h>
+#include "RingQueue.hpp"
+
+
+namespace
+{
+    // A value whose moves throw once movesLeft reaches zero
+    struct FragileValue
+    {
+        static int movesLeft;
+
+        int value;
+
+        FragileValue(int value)
+            : value{value}
+        {
+        }
+
+        FragileValue(const FragileValue& other) = default;
+
+        FragileValue(FragileValue&& other)
+            : value{other.value}
+        {
+            if (movesLeft-- == 0)
+            {
+                throw 46;
+            }
+        }
+    };
+
+    int FragileValue::movesLeft = 1000000;
+}
+
+
+TEST(RingQueueTests, emptyWhenDefaultConstructed)
+{
+    RingQueue<int> q;
+
+    EXPECT_TRUE(q.isEmpty());
+    EXPECT_EQ(0, q.size());
+    EXPECT_EQ(0, q.capacity());
+    EXPECT_THROW(q.front(), EmptyException);
+    EXPECT_THROW(q.dequeue(), EmptyException);
+}
+
+
+TEST(RingQueueTests, queueOrderingIsCorrectAcrossWrapAroundAndGrowth)
+{
+    RingQueue<int> q;
+    int nextIn = 0;
+    int nextOut = 0;
+
+    for (unsigned int round = 0; round < 100; ++round)
+    {
+        for (unsigned int i = 0; i < round % 7 + 1; ++i)
+        {
+            q.enqueue(nextIn++);
+        }
+
+        for (unsigned int i = 0; i < round % 5 + 1 && !q.isEmpty(); ++i)
+        {
+            EXPECT_EQ(nextOut++, q.front());
+            q.dequeue();
+        }
+    }
+
+    EXPECT_EQ(static_cast<unsigned int>(nextIn - nextOut), q.size());
+}
+
+
+TEST(RingQueueTests, steadyStateUseDoesNotGrowTheQueue)
+{
+    RingQueue<std::string> q;
+
+    for (unsigned int i = 0; i < 5; ++i)
+    {
+        q.enqueue("Boo");
+    }
+
+    unsigned int capacity = q.capacity();
+
+    for (unsigned int i = 0; i < 1000; ++i)
+    {
+        q.enqueue(q.front());
+        q.dequeue();
+    }
+
+    EXPECT_EQ(capacity, q.capacity());
+    EXPECT_EQ(5, q.size());
+}
+
+
+TEST(RingQueueTests, enqueuingItsOwnFrontWhenFullIsSafe)
+{
+    RingQueue<std::string> q;
+    q.reserve(2);
+    q.enqueue("Boo is the very best dog in the world");
+    q.enqueue("Boo is happy today");
+
+    q.enqueue(q.front());
+
+    EXPECT_EQ(3, q.size());
+    q.dequeue();
+    q.dequeue();
+    EXPECT_EQ("Boo is the very best dog in the world", q.front());
+}
+
+
+TEST(RingQueueTests, canMoveAndEmplaceValues)
+{
+    RingQueue<std::unique_ptr<int>> pointers;
+    pointers.enqueue(std::make_unique<int>(46));
+    EXPECT_EQ(46, *pointers.front());
+
+    // Parentheses, not braces, so this is three a's rather than "\3a"
+    RingQueue<std::string> strings;
+    strings.emplace(3, 'a');
+    EXPECT_EQ("aaa", strings.front());
+}
+
+
+TEST(RingQueueTests, enqueuingARangeOfItsOwnValuesWhenFullIsSafe)
+{
+    RingQueue<std::string> q;
+    q.reserve(8);
+
+    for (int i = 0; i < 8; ++i)
+    {
+        q.enqueue("Boo is the very best dog in the world, number " + std::to_string(i));
+    }
+
+    q.enqueueRange(&q.front(), 8);
+
+    ASSERT_EQ(16, q.size());
+
+    for (int i = 0; i < 16; ++i)
+    {
+        EXPECT_EQ("Boo is the very best dog in the world, number " + std::to_string(i % 8), q.front());
+        q.dequeue();
+    }
+}
+
+
+TEST(RingQueueTests, queueIsUnchangedWhenAMoveThrowsWhileGrowing)
+{
+    RingQueue<FragileValue> q;
+
+    for (int i = 0; i < 8; ++i)
+    {
+        q.enqueue(FragileValue{i});
+    }
+
+    ASSERT_EQ(8, q.capacity());
+
+    FragileValue::movesLeft = 3;
+    EXPECT_THROW(q.enqueue(FragileValue{8}), int);
+    FragileValue::movesLeft = 3;
+    EXPECT_THROW(q.reserve(64), int);
+
+    ASSERT_EQ(8, q.size());
+    EXPECT_EQ(8, q.capacity());
+
+    for (int i = 0; i < 8; ++i)
+    {
+        EXPECT_EQ(i, q.front().value);
+        q.dequeue();
+    }
+}
+
+
+TEST(RingQueueTests, canEnqueueAndDequeueInBatches)
+{
+    int values[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    RingQueue<int> q;
+    q.enqueue(-1);
+    q.enqueueRange(values, 10);
+    EXPECT_EQ(11, q.size());
+
+    int out[20];
+    EXPECT_EQ(4, q.dequeueN(out, 4));
+    EXPECT_EQ(-1, out[0]);
+    EXPECT_EQ(2, out[3]);
+
+    EXPECT_EQ(7, q.dequeueN(out, 20));
+    EXPECT_EQ(3, out[0]);
+    EXPECT_EQ(9, out[6]);
+    EXPECT_TRUE(q.isEmpty());
+    EXPECT_EQ(0, q.dequeueN(out, 20));
+}
+
+
+TEST(RingQueueTests, canIterateInQueueOrder)
+{
+    RingQueue<int> q;
+
+    for (int i = 0; i < 20; ++i)
+    {
+        q.enqueue(i);
+    }
+
+    for (int i = 0; i < 10; ++i)
+    {
+        q.dequeue();
+    }
+
+    int expected = 10;
+    RingQueue<int>::ConstIterator i = q.constIterator();
+
+    for (; !i.isPastEnd(); i.moveToNext())
+    {
+        EXPECT_EQ(expected++, i.value());
+    }
+
+    EXPECT_EQ(20, expected);
+    EXPECT_THROW(i.value(), IteratorException);
+
+    i.moveToPrevious();
+    EXPECT_EQ(19, i.value());
+}
+
+
+TEST(RingQueueTests, copiesAreIndependent)
+{
+    RingQueue<std::string> q;
+    q.enqueue("Boo");
+    q.enqueue("is");
+
+    RingQueue<std::string> copy{q};
+    copy.dequeue();
+    copy.enqueue("happy");
+
+    EXPECT_EQ("Boo", q.front());
+    EXPECT_EQ(2, q.size());
+    EXPECT_EQ("is", copy.front());
+
+    q = copy;
+    EXPECT_EQ("is", q.front());
+
+    RingQueue<std::string> moved{std::move(copy)};
+    EXPECT_TRUE(copy.isEmpty());
+    EXPECT_EQ(2, moved.size());
+}
@@ -0,0 +1,120 @@
+// SpscQueueTests.cpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// Unit tests for SpscQueue<ValueType>.
+
+#include <string>
+#include <thread>
+#include <gtest/gtest.h>
+#include "SpscQueue.hpp"
+
+
+TEST(SpscQueueTests, capacityIsRoundedUpToAPowerOfTwo)
+{
+    SpscQueue<int> q{5};
+
+    EXPECT_EQ(8, q.capacity());
+    EXPECT_TRUE(q.isEmpty());
+    EXPECT_EQ(0, q.size());
+}
+
+
+TEST(SpscQueueTests, emptyQueuesThrowOrFailWithoutThrowing)
+{
+    SpscQueue<int> q{4};
+    int value = 46;
+
+    EXPECT_THROW(q.front(), EmptyException);
+    EXPECT_THROW(q.dequeue(), EmptyException);
+    EXPECT_FALSE(q.tryDequeue(value));
+    EXPECT_EQ(46, value);
+}
+
+
+TEST(SpscQueueTests, fullQueuesRefuseMoreValues)
+{
+    SpscQueue<std::string> q{4};
+
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(q.tryEnqueue("Boo"));
+    }
+
+    std::string value = "happy";
+    EXPECT_FALSE(q.tryEnqueue(std::move(value)));
+    EXPECT_EQ("happy", value);
+    EXPECT_EQ(4, q.size());
+
+    q.dequeue();
+    EXPECT_TRUE(q.tryEnqueue(std::move(value)));
+}
+
+
+TEST(SpscQueueTests, queueOrderingIsCorrectAcrossWrapAround)
+{
+    SpscQueue<int> q{64};
+    int nextOut = 0;
+
+    for (int i = 0; i < 150; ++i)
+    {
+        q.enqueue(i);
+
+        if (i % 3 != 0)
+        {
+            int value;
+            EXPECT_TRUE(q.tryDequeue(value));
+            EXPECT_EQ(nextOut++, value);
+        }
+    }
+
+    while (!q.isEmpty())
+    {
+        EXPECT_EQ(nextOut++, q.front());
+        q.dequeue();
+    }
+
+    EXPECT_EQ(150, nextOut);
+}
+
+
+TEST(SpscQueueTests, valuesPassBetweenThreadsInOrder)
+{
+    constexpr int count = 1000000;
+    SpscQueue<int> q{64};
+
+    std::thread producer{
+        [&q]()
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                q.enqueue(i);
+            }
+        }};
+
+    long long sum = 0;
+    bool inOrder = true;
+    int expected = 0;
+
+    while (expected < count)
+    {
+        int value;
+        if (q.tryDequeue(value))
+        {
+            inOrder = inOrder && value == expected;
+            sum += value;
+            ++expected;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+
+    EXPECT_TRUE(inOrder);
+    EXPECT_EQ(static_cast<long long>(count) * (count - 1) / 2, sum);
+    EXPECT_TRUE(q.isEmpty());
+}
@@ -0,0 +1,260 @@
+// UnrolledLinkedListTests.cpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// Unit tests for UnrolledLinkedList<ValueType>.  Small chunk capacities
+// are used in most of them, so that chunks are split and merged often.
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "UnrolledLinkedList.hpp"
+
+
+namespace
+{
+    template <typename List>
+    std::vector<std::string> contentsOf(const List& list)
+    {
+        std::vector<std::string> contents;
+
+        for (auto i = list.constIterator(); !i.isPastEnd(); i.moveToNext())
+        {
+            contents.push_back(i.value());
+        }
+
+        return contents;
+    }
+}
+
+
+TEST(UnrolledLinkedListTests, emptyWhenDefaultConstructed)
+{
+    UnrolledLinkedList<int> list;
+
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_EQ(0, list.size());
+    EXPECT_THROW(list.first(), EmptyException);
+    EXPECT_THROW(list.removeFromEnd(), EmptyException);
+
+    UnrolledLinkedList<int>::ConstIterator i = list.constIterator();
+    EXPECT_TRUE(i.isPastStart());
+    EXPECT_TRUE(i.isPastEnd());
+}
+
+
+TEST(UnrolledLinkedListTests, addingAndRemovingAtBothEndsAcrossManyChunks)
+{
+    UnrolledLinkedList<int, 4> list;
+
+    for (int i = 0; i < 100; ++i)
+    {
+        list.addToEnd(i);
+        list.addToStart(-i - 1);
+    }
+
+    EXPECT_EQ(200, list.size());
+    EXPECT_EQ(-100, list.first());
+    EXPECT_EQ(99, list.last());
+
+    int expected = -100;
+    for (auto i = list.constIterator(); !i.isPastEnd(); i.moveToNext())
+    {
+        EXPECT_EQ(expected, i.value());
+        ++expected;
+    }
+
+    for (int i = 0; i < 100; ++i)
+    {
+        list.removeFromStart();
+        list.removeFromEnd();
+    }
+
+    EXPECT_TRUE(list.isEmpty());
+}
+
+
+TEST(UnrolledLinkedListTests, iteratorsCanMoveBackward)
+{
+    UnrolledLinkedList<int, 4> list;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        list.addToEnd(i);
+    }
+
+    auto i = list.constIterator();
+    while (!i.isPastEnd())
+    {
+        i.moveToNext();
+    }
+
+    for (int expected = 9; expected >= 0; --expected)
+    {
+        i.moveToPrevious();
+        EXPECT_EQ(expected, i.value());
+    }
+
+    i.moveToPrevious();
+    EXPECT_TRUE(i.isPastStart());
+    EXPECT_THROW(i.moveToPrevious(), IteratorException);
+}
+
+
+TEST(UnrolledLinkedListTests, insertingInTheMiddleKeepsTheIteratorOnItsValue)
+{
+    UnrolledLinkedList<std::string, 4> list;
+    list.addToEnd("Boo");
+    list.addToEnd("happy");
+
+    auto i = list.iterator();
+    i.moveToNext();
+
+    for (int n = 0; n < 10; ++n)
+    {
+        i.insertBefore("very");
+        EXPECT_EQ("happy", i.value());
+    }
+
+    i.insertAfter("today");
+    EXPECT_EQ("happy", i.value());
+
+    std::vector<std::string> expected{"Boo"};
+    expected.insert(expected.end(), 10, "very");
+    expected.push_back("happy");
+    expected.push_back("today");
+
+    EXPECT_EQ(expected, contentsOf(list));
+}
+
+
+TEST(UnrolledLinkedListTests, removingMovesToTheNextOrPreviousValue)
+{
+    UnrolledLinkedList<std::string, 4> list;
+
+    for (const char* word : {"Boo", "is", "very", "very", "happy", "today"})
+    {
+        list.addToEnd(word);
+    }
+
+    auto i = list.iterator();
+    i.moveToNext();
+    i.moveToNext();
+    i.remove();
+    EXPECT_EQ("very", i.value());
+
+    i.remove(false);
+    EXPECT_EQ("is", i.value());
+
+    EXPECT_EQ((std::vector<std::string>{"Boo", "is", "happy", "today"}), contentsOf(list));
+}
+
+
+TEST(UnrolledLinkedListTests, randomEditsMatchAVector)
+{
+    UnrolledLinkedList<std::string, 4> list;
+    std::vector<std::string> expected;
+    unsigned int seed = 46;
+
+    auto next = [&seed]()
+    {
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 16) & 0x7fff;
+    };
+
+    for (unsigned int round = 0; round < 2000; ++round)
+    {
+        std::string value = std::to_string(round);
+        unsigned int choice = next() % 6;
+
+        if (choice == 0)
+        {
+            list.addToStart(value);
+            expected.insert(expected.begin(), value);
+        }
+        else if (choice == 1)
+        {
+            list.addToEnd(value);
+            expected.push_back(value);
+        }
+        else if (expected.empty())
+        {
+            continue;
+        }
+        else
+        {
+            unsigned int index = next() % expected.size();
+
+            auto i = list.iterator();
+            for (unsigned int n = 0; n < index; ++n)
+            {
+                i.moveToNext();
+            }
+
+            if (choice == 2)
+            {
+                i.insertBefore(value);
+                expected.insert(expected.begin() + index, value);
+                ++index;
+            }
+            else if (choice == 3)
+            {
+                i.insertAfter(value);
+                expected.insert(expected.begin() + index + 1, value);
+            }
+            else
+            {
+                i.remove(choice == 4);
+                expected.erase(expected.begin() + index);
+
+                if (choice == 5)
+                {
+                    if (index == 0)
+                    {
+                        EXPECT_TRUE(i.isPastStart());
+                        continue;
+                    }
+                    --index;
+                }
+            }
+
+            if (index < expected.size())
+            {
+                ASSERT_EQ(expected[index], i.value());
+            }
+            else
+            {
+                ASSERT_TRUE(i.isPastEnd());
+            }
+        }
+
+        ASSERT_EQ(expected.size(), list.size());
+    }
+
+    EXPECT_EQ(expected, contentsOf(list));
+}
+
+
+TEST(UnrolledLinkedListTests, copiesAreIndependent)
+{
+    UnrolledLinkedList<int, 4> list;
+
+    for (int i = 0; i < 20; ++i)
+    {
+        list.addToEnd(i);
+    }
+
+    UnrolledLinkedList<int, 4> copy{list};
+    copy.removeFromStart();
+    copy.addToEnd(100);
+
+    EXPECT_EQ(0, list.first());
+    EXPECT_EQ(19, list.last());
+    EXPECT_EQ(1, copy.first());
+    EXPECT_EQ(100, copy.last());
+
+    list = copy;
+    EXPECT_EQ(20, list.size());
+    EXPECT_EQ(100, list.last());
+}
@@ -0,0 +1,189 @@
+// WorkQueueTests.cpp
+//
+// ICS 46 Spring 2020
+// Project #2: Time Waits for No One
+//
+// Unit tests for WorkQueue<ValueType>.
+
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "WorkQueue.hpp"
+
+
+TEST(WorkQueueTests, valuesComeOutInQueueOrder)
+{
+    WorkQueue<int> q{10};
+
+    for (int i = 0; i < 5; ++i)
+    {
+        q.enqueue(i);
+    }
+
+    EXPECT_EQ(5, q.size());
+
+    for (int i = 0; i < 5; ++i)
+    {
+        int value;
+        EXPECT_TRUE(q.tryDequeue(value));
+        EXPECT_EQ(i, value);
+    }
+
+    int value = 46;
+    EXPECT_FALSE(q.tryDequeue(value));
+    EXPECT_EQ(46, value);
+}
+
+
+TEST(WorkQueueTests, fullQueuesRefuseTryEnqueue)
+{
+    WorkQueue<int> q{2};
+
+    EXPECT_TRUE(q.tryEnqueue(1));
+    EXPECT_TRUE(q.tryEnqueue(2));
+    EXPECT_FALSE(q.tryEnqueue(3));
+    EXPECT_EQ(2, q.size());
+}
+
+
+TEST(WorkQueueTests, queuesMustHaveRoomForAValue)
+{
+    EXPECT_THROW(WorkQueue<int>{0}, CapacityException);
+}
+
+
+TEST(WorkQueueTests, closedQueuesDrainThenReportTheyAreDone)
+{
+    WorkQueue<int> q{10};
+    q.enqueue(1);
+    q.enqueue(2);
+    q.close();
+
+    EXPECT_TRUE(q.isClosed());
+    EXPECT_THROW(q.enqueue(3), ClosedException);
+    EXPECT_FALSE(q.tryEnqueue(3));
+
+    int value;
+    EXPECT_TRUE(q.dequeue(value));
+    EXPECT_EQ(1, value);
+    EXPECT_TRUE(q.dequeue(value));
+    EXPECT_EQ(2, value);
+    EXPECT_FALSE(q.dequeue(value));
+    EXPECT_EQ(0, q.dequeueN(&value, 1));
+}
+
+
+TEST(WorkQueueTests, closingWakesWaitingConsumers)
+{
+    WorkQueue<int> q{10};
+    bool result = true;
+
+    std::thread consumer{
+        [&q, &result]()
+        {
+            int value;
+            result = q.dequeue(value);
+        }};
+
+    q.close();
+    consumer.join();
+
+    EXPECT_FALSE(result);
+}
+
+
+TEST(WorkQueueTests, batchesCanBeLargerThanTheQueue)
+{
+    WorkQueue<int> q{4};
+    std::vector<int> values(100);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        values[i] = i;
+    }
+
+    std::thread producer{
+        [&q, &values]()
+        {
+            q.enqueueRange(values.data(), values.size());
+            q.close();
+        }};
+
+    std::vector<int> received;
+    int batch[8];
+    unsigned int count;
+
+    while ((count = q.dequeueN(batch, 8)) > 0)
+    {
+        EXPECT_LE(count, 4);
+        received.insert(received.end(), batch, batch + count);
+    }
+
+    producer.join();
+
+    EXPECT_EQ(values, received);
+}
+
+
+TEST(WorkQueueTests, manyProducersAndConsumersSeeEveryValueOnce)
+{
+    constexpr int producerCount = 4;
+    constexpr int consumerCount = 4;
+    constexpr int valuesPerProducer = 20000;
+
+    WorkQueue<int> q{64};
+    std::vector<long long> sums(consumerCount, 0);
+    std::vector<int> counts(consumerCount, 0);
+
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < consumerCount; ++c)
+    {
+        consumers.emplace_back(
+            [&q, &sums, &counts, c]()
+            {
+                int value;
+                while (q.dequeue(value))
+                {
+                    sums[c] += value;
+                    ++counts[c];
+                }
+            });
+    }
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producerCount; ++p)
+    {
+        producers.emplace_back(
+            [&q, p]()
+            {
+                for (int i = 0; i < valuesPerProducer; ++i)
+                {
+                    q.enqueue(p * valuesPerProducer + i);
+                }
+            });
+    }
+
+    for (std::thread& producer : producers)
+    {
+        producer.join();
+    }
+
+    q.close();
+
+    for (std::thread& consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    long long total = 0;
+    int count = 0;
+    for (int c = 0; c < consumerCount; ++c)
+    {
+        total += sums[c];
+        count += counts[c];
+    }
+
+    long long n = producerCount * valuesPerProducer;
+    EXPECT_EQ(n, count);
+    EXPECT_EQ(n * (n - 1) / 2, total);
+}
@@ -30,7 +30,11 @@ class AVLSet : public Set<ElementType>
 {
 public:
     // A VisitFunction is a function that takes a reference to a const
-    // ElementType and returns no value.
+    // ElementType and returns no value.  The traversals below can also be
+    // given any other callable object (e.g., a lambda) directly, which
+    // lets the compiler inline it into the traversal instead of calling it
+    // through a std::function at every node; the versions that take a
+    // VisitFunction just pass it along to those.
     using VisitFunction = std::function<void(const ElementType&)>;
 
 public:
@@ -85,18 +89,27 @@ public:
     // tree.
     void preorder(VisitFunction visit) const;
 
+    template <typename Visitor>
+    void preorder(Visitor&& visit) const;
+
 
     // inorder() calls the given "visit" function for each of the elements
     // in the set, in the order determined by an inorder traversal of the AVL
     // tree.
     void inorder(VisitFunction visit) const;
 
+    template <typename Visitor>
+    void inorder(Visitor&& visit) const;
+
 
     // postorder() calls the given "visit" function for each of the elements
     // in the set, in the order determined by a postorder traversal of the AVL
     // tree.
     void postorder(VisitFunction visit) const;
 
+    template <typename Visitor>
+    void postorder(Visitor&& visit) const;
+
 
 private:
     // You'll no doubt want to add member variables and "helper" member
@@ -178,18 +191,42 @@ int AVLSet<ElementType>::height() const noexcept
 
 template <typename ElementType>
 void AVLSet<ElementType>::preorder(VisitFunction visit) const
+{
+    preorder<const VisitFunction&>(visit);
+}
+
+
+template <typename ElementType>
+template <typename Visitor>
+void AVLSet<ElementType>::preorder(Visitor&&) const
 {
 }
 
 
 template <typename ElementType>
 void AVLSet<ElementType>::inorder(VisitFunction visit) const
+{
+    inorder<const VisitFunction&>(visit);
+}
+
+
+template <typename ElementType>
+template <typename Visitor>
+void AVLSet<ElementType>::inorder(Visitor&&) const
 {
 }
 
 
 template <typename ElementType>
 void AVLSet<ElementType>::postorder(VisitFunction visit) const
+{
+    postorder<const VisitFunction&>(visit);
+}
+
+
+template <typename ElementType>
+template <typename Visitor>
+void AVLSet<ElementType>::postorder(Visitor&&) const
 {
 }
 
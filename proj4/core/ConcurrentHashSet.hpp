@@ -0,0 +1,462 @@
+// ConcurrentHashSet.hpp
+//
+// ICS 46 Spring 2020
+// Project #4: Set the Controls for the Heart of the Sun
+//
+// A ConcurrentHashSet is an implementation of a Set that can be used by
+// many threads at once: any number of them can call contains() while
+// others call add().
+//
+// The elements are split among a fixed number of shards by their hashes,
+// and each shard is a separately-chained hash table of its own.  Calls to
+// add() that land in the same shard take turns, holding that shard's
+// mutex, but calls to contains() never lock anything.  Instead, a node is
+// never changed once it's been linked into a table, and add() links each
+// new one in with a single atomic store, so a reader walking a chain sees
+// either the chain as it was or the chain with the new node at its front.
+// When a shard's table grows, its elements are copied into a new table
+// that then replaces the old one, the same way; the old one can't be
+// deleted, because a reader might still be walking it, so it's kept until
+// the set is frozen or destroyed.  Since each table is twice as large as
+// the last, the old ones never add up to more than the current one.
+//
+// Once every element has been added, the set can be frozen, which moves
+// all of them into one table that's never changed again, so contains()
+// reads it without even atomic loads.  A frozen set can't be added to.
+// freeze() itself must not run while any other thread is using the set.
+//
+// Hashes are scrambled with a multiplication before they're used, so that
+// the shard and the index within its table come from different bits, both
+// of which depend on the whole hash.
+
+#ifndef CONCURRENTHASHSET_HPP
+#define CONCURRENTHASHSET_HPP
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include "Set.hpp"
+
+
+
+template <typename ElementType>
+class ConcurrentHashSet : public Set<ElementType>
+{
+public:
+    // The number of shards the elements are split among.
+    static constexpr unsigned int SHARD_COUNT = 16;
+
+    // The default capacity of each shard's table before anything has
+    // been added to it.
+    static constexpr unsigned int DEFAULT_SHARD_CAPACITY = 16;
+
+    // A HashFunction is a function that takes a reference to a const
+    // ElementType and returns an unsigned int.
+    using HashFunction = std::function<unsigned int(const ElementType&)>;
+
+    // A FrozenException is thrown when add() is called on a frozen set.
+    class FrozenException { };
+
+public:
+    // Initializes a ConcurrentHashSet to be empty, so that it will use the
+    // given hash function whenever it needs to hash an element.  If it's
+    // known about how many elements will be added, the shards' tables can
+    // be made large enough to start with that they'll never need to grow.
+    explicit ConcurrentHashSet(HashFunction hashFunction, unsigned int expectedSize = 0);
+
+    // Cleans up the ConcurrentHashSet so that it leaks no memory.
+    ~ConcurrentHashSet() noexcept override;
+
+    // A ConcurrentHashSet can be neither copied nor moved, since other
+    // threads might be using it while that happened.
+    ConcurrentHashSet(const ConcurrentHashSet& s) = delete;
+    ConcurrentHashSet& operator=(const ConcurrentHashSet& s) = delete;
+
+
+    bool isImplemented() const noexcept override;
+
+
+    // add() adds an element to the set.  If the element is already in the
+    // set, this function has no effect.  When a shard's table would be more
+    // than 3/4 full, it doubles in capacity first, which takes time linear
+    // in the number of elements in that shard; otherwise, this runs in
+    // constant time (assuming a good hash function).  Throws a
+    // FrozenException if the set has been frozen.
+    void add(const ElementType& element) override;
+
+
+    // contains() returns true if the given element is already in the set,
+    // false otherwise.  It never waits for other threads, and runs in
+    // constant time (assuming a good hash function).
+    bool contains(const ElementType& element) const override;
+
+
+    // size() returns the number of elements in the set.  While other
+    // threads are adding elements, it may not count the newest ones.
+    unsigned int size() const noexcept override;
+
+
+    // freeze() makes the set read-only, moving its elements into a single
+    // table that contains() can read with no synchronization at all.  It
+    // must not be called while any other thread is using the set.
+    // Freezing a set that's already frozen has no effect.
+    void freeze();
+
+
+    // isFrozen() returns true if the set has been frozen.
+    bool isFrozen() const noexcept;
+
+
+private:
+    struct Node
+    {
+        ElementType element;
+        unsigned long long scrambled;
+        Node* next;
+    };
+
+    struct Table
+    {
+        std::atomic<Node*>* buckets;
+        unsigned int capacity;
+
+        // The table that this one replaced, which is kept until the set
+        // is frozen or destroyed.
+        Table* replaced;
+    };
+
+    // Each shard gets its own cache line, so that threads adding to
+    // different shards don't slow each other down.
+    struct alignas(64) Shard
+    {
+        std::mutex mutex;
+        std::atomic<Table*> table;
+        std::atomic<unsigned int> elements;
+    };
+
+    HashFunction hashFunction;
+    Shard shards[SHARD_COUNT];
+
+    // Once the set is frozen, all of its elements are in frozenBuckets,
+    // and the shards' tables are gone.
+    bool frozen;
+    Node** frozenBuckets;
+    unsigned int frozenCapacity;
+
+    unsigned long long scramble(const ElementType& element) const;
+    static unsigned int shardIndex(unsigned long long scrambled) noexcept;
+    static unsigned int bucketIndex(unsigned long long scrambled, unsigned int capacity) noexcept;
+    static unsigned int capacityFor(unsigned int elements) noexcept;
+
+    static bool isInChain(const Node* chain, const ElementType& element, unsigned long long scrambled);
+
+    static Table* createTable(unsigned int capacity);
+    static void destroyTables(Table* table, bool includingNodes) noexcept;
+    void grow(Shard& shard);
+};
+
+
+
+template <typename ElementType>
+ConcurrentHashSet<ElementType>::ConcurrentHashSet(HashFunction hashFunction, unsigned int expectedSize)
+    : hashFunction{hashFunction}, frozen{false}, frozenBuckets{nullptr}, frozenCapacity{0}
+{
+    unsigned int shardCapacity = capacityFor(expectedSize / SHARD_COUNT + 1);
+    if (shardCapacity < DEFAULT_SHARD_CAPACITY) {
+        shardCapacity = DEFAULT_SHARD_CAPACITY;
+    }
+
+    unsigned int created = 0;
+
+    try {
+        for (; created < SHARD_COUNT; ++created) {
+            shards[created].table.store(createTable(shardCapacity), std::memory_order_relaxed);
+            shards[created].elements.store(0, std::memory_order_relaxed);
+        }
+    } catch (...) {
+        for (unsigned int i = 0; i < created; ++i) {
+            destroyTables(shards[i].table.load(std::memory_order_relaxed), true);
+        }
+        throw;
+    }
+}
+
+
+template <typename ElementType>
+ConcurrentHashSet<ElementType>::~ConcurrentHashSet() noexcept
+{
+    if (frozen) {
+        for (unsigned int i = 0; i < frozenCapacity; ++i) {
+            Node* current = frozenBuckets[i];
+            while (current != nullptr) {
+                Node* next = current->next;
+                delete current;
+                current = next;
+            }
+        }
+
+        delete[] frozenBuckets;
+    } else {
+        for (unsigned int i = 0; i < SHARD_COUNT; ++i) {
+            destroyTables(shards[i].table.load(std::memory_order_relaxed), true);
+        }
+    }
+}
+
+
+template <typename ElementType>
+bool ConcurrentHashSet<ElementType>::isImplemented() const noexcept
+{
+    return true;
+}
+
+
+template <typename ElementType>
+void ConcurrentHashSet<ElementType>::add(const ElementType& element)
+{
+    if (frozen) {
+        throw FrozenException{};
+    }
+
+    unsigned long long scrambled = scramble(element);
+    Shard& shard = shards[shardIndex(scrambled)];
+
+    std::lock_guard<std::mutex> lock{shard.mutex};
+
+    //Only this thread can change the shard's table while it holds the
+    //mutex, so it needn't be careful about reading it
+    Table* table = shard.table.load(std::memory_order_relaxed);
+    std::atomic<Node*>& bucket = table->buckets[bucketIndex(scrambled, table->capacity)];
+
+    if (isInChain(bucket.load(std::memory_order_relaxed), element, scrambled)) {
+        return;
+    }
+
+    unsigned int elements = shard.elements.load(std::memory_order_relaxed);
+
+    if ((elements + 1) * 4 > table->capacity * 3) {
+        grow(shard);
+        table = shard.table.load(std::memory_order_relaxed);
+    }
+
+    std::atomic<Node*>& newBucket = table->buckets[bucketIndex(scrambled, table->capacity)];
+
+    //The release store publishes the node, fully constructed, to readers
+    //that load the bucket with acquire
+    newBucket.store(
+        new Node{element, scrambled, newBucket.load(std::memory_order_relaxed)},
+        std::memory_order_release);
+
+    shard.elements.store(elements + 1, std::memory_order_relaxed);
+}
+
+
+template <typename ElementType>
+bool ConcurrentHashSet<ElementType>::contains(const ElementType& element) const
+{
+    unsigned long long scrambled = scramble(element);
+
+    if (frozen) {
+        return isInChain(frozenBuckets[bucketIndex(scrambled, frozenCapacity)], element, scrambled);
+    }
+
+    const Shard& shard = shards[shardIndex(scrambled)];
+    const Table* table = shard.table.load(std::memory_order_acquire);
+    const Node* chain = table->buckets[bucketIndex(scrambled, table->capacity)].load(std::memory_order_acquire);
+
+    return isInChain(chain, element, scrambled);
+}
+
+
+template <typename ElementType>
+unsigned int ConcurrentHashSet<ElementType>::size() const noexcept
+{
+    unsigned int total = 0;
+
+    for (unsigned int i = 0; i < SHARD_COUNT; ++i) {
+        total += shards[i].elements.load(std::memory_order_relaxed);
+    }
+
+    return total;
+}
+
+
+template <typename ElementType>
+void ConcurrentHashSet<ElementType>::freeze()
+{
+    if (frozen) {
+        return;
+    }
+
+    //The nodes are relinked into the frozen table rather than copied;
+    //nothing else is using the set, so no one can be walking their chains
+    unsigned int capacity = capacityFor(size());
+    Node** buckets = new Node*[capacity];
+
+    for (unsigned int i = 0; i < capacity; ++i) {
+        buckets[i] = nullptr;
+    }
+
+    for (unsigned int i = 0; i < SHARD_COUNT; ++i) {
+        Table* table = shards[i].table.load(std::memory_order_relaxed);
+
+        for (unsigned int j = 0; j < table->capacity; ++j) {
+            Node* current = table->buckets[j].load(std::memory_order_relaxed);
+            while (current != nullptr) {
+                Node* next = current->next;
+                unsigned int index = bucketIndex(current->scrambled, capacity);
+                current->next = buckets[index];
+                buckets[index] = current;
+                current = next;
+            }
+        }
+
+        destroyTables(table, false);
+        shards[i].table.store(nullptr, std::memory_order_relaxed);
+    }
+
+    frozenBuckets = buckets;
+    frozenCapacity = capacity;
+    frozen = true;
+}
+
+
+template <typename ElementType>
+bool ConcurrentHashSet<ElementType>::isFrozen() const noexcept
+{
+    return frozen;
+}
+
+
+template <typename ElementType>
+unsigned long long ConcurrentHashSet<ElementType>::scramble(const ElementType& element) const
+{
+    return static_cast<unsigned long long>(hashFunction(element)) * 0x9E3779B97F4A7C15ull;
+}
+
+
+//The shard comes from the top 4 bits of the scrambled hash, which are the
+//ones that depend on all of the bits of the hash
+template <typename ElementType>
+unsigned int ConcurrentHashSet<ElementType>::shardIndex(unsigned long long scrambled) noexcept
+{
+    return static_cast<unsigned int>(scrambled >> 60);
+}
+
+
+//The index within a table comes from the 32 bits below those, so that
+//the elements in a shard aren't all at indexes with the same high bits
+template <typename ElementType>
+unsigned int ConcurrentHashSet<ElementType>::bucketIndex(
+    unsigned long long scrambled, unsigned int capacity) noexcept
+{
+    return static_cast<unsigned int>(scrambled >> 28) & (capacity - 1);
+}
+
+
+//Returns the smallest power of two that can hold the given number of
+//elements while being no more than 3/4 full
+template <typename ElementType>
+unsigned int ConcurrentHashSet<ElementType>::capacityFor(unsigned int elements) noexcept
+{
+    unsigned int capacity = 1;
+    while (capacity * 3 < elements * 4) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+
+//Nodes whose scrambled hashes differ can't hold equal elements, so the
+//elements are only compared when those match
+template <typename ElementType>
+bool ConcurrentHashSet<ElementType>::isInChain(
+    const Node* chain, const ElementType& element, unsigned long long scrambled)
+{
+    for (const Node* temp = chain; temp != nullptr; temp = temp->next) {
+        if (temp->scrambled == scrambled && temp->element == element) {return true;}
+    }
+    return false;
+}
+
+
+template <typename ElementType>
+typename ConcurrentHashSet<ElementType>::Table* ConcurrentHashSet<ElementType>::createTable(
+    unsigned int capacity)
+{
+    std::atomic<Node*>* buckets = new std::atomic<Node*>[capacity];
+
+    for (unsigned int i = 0; i < capacity; ++i) {
+        buckets[i].store(nullptr, std::memory_order_relaxed);
+    }
+
+    try {
+        return new Table{buckets, capacity, nullptr};
+    } catch (...) {
+        delete[] buckets;
+        throw;
+    }
+}
+
+
+//Destroys a table and every table it replaced.  The nodes in the most
+//recent table are destroyed, too, if asked; the ones in the tables it
+//replaced are always destroyed, since they were copied into the next one
+template <typename ElementType>
+void ConcurrentHashSet<ElementType>::destroyTables(Table* table, bool includingNodes) noexcept
+{
+    bool destroyNodes = includingNodes;
+
+    while (table != nullptr) {
+        if (destroyNodes) {
+            for (unsigned int i = 0; i < table->capacity; ++i) {
+                Node* current = table->buckets[i].load(std::memory_order_relaxed);
+                while (current != nullptr) {
+                    Node* next = current->next;
+                    delete current;
+                    current = next;
+                }
+            }
+        }
+
+        Table* replaced = table->replaced;
+        delete[] table->buckets;
+        delete table;
+
+        table = replaced;
+        destroyNodes = true;
+    }
+}
+
+
+//Replaces a shard's table (whose mutex must be held) with one of twice the
+//capacity.  Readers may still be walking the old table's chains, so its
+//nodes are copied rather than relinked, and the old table is kept.
+template <typename ElementType>
+void ConcurrentHashSet<ElementType>::grow(Shard& shard)
+{
+    Table* oldTable = shard.table.load(std::memory_order_relaxed);
+    Table* newTable = createTable(oldTable->capacity * 2);
+
+    try {
+        for (unsigned int i = 0; i < oldTable->capacity; ++i) {
+            const Node* current = oldTable->buckets[i].load(std::memory_order_relaxed);
+            for (; current != nullptr; current = current->next) {
+                std::atomic<Node*>& bucket = newTable->buckets[bucketIndex(current->scrambled, newTable->capacity)];
+                bucket.store(
+                    new Node{current->element, current->scrambled, bucket.load(std::memory_order_relaxed)},
+                    std::memory_order_relaxed);
+            }
+        }
+    } catch (...) {
+        destroyTables(newTable, true);
+        throw;
+    }
+
+    newTable->replaced = oldTable;
+    shard.table.store(newTable, std::memory_order_release);
+}
+
+
+
+#endif // CONCURRENTHASHSET_HPP
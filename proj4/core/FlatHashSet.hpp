@@ -0,0 +1,568 @@
+// FlatHashSet.hpp
+//
+// ICS 46 Spring 2020
+// Project #4: Set the Controls for the Heart of the Sun
+//
+// A FlatHashSet is an implementation of a Set that, unlike HashSet, is an
+// open-addressing hash table: rather than keeping a linked list of the
+// elements that hash to each index, it stores the elements themselves in
+// one flat array, each at its hashed index or, if that's taken, at the
+// next free one after it.  Looking for an element is then a matter of
+// scanning forward from its index to the first free one, through memory
+// that's contiguous, instead of chasing pointers from node to node.
+//
+// Alongside the elements is a parallel array of "control bytes," one per
+// element, each either marking its element as empty or holding 7 bits of
+// that element's hash.  The scan looks at the control bytes sixteen at a
+// time -- with a single SSE2 comparison, where that's available -- and
+// only compares elements whose control bytes match, so a lookup rarely
+// compares more than the one element it's looking for and usually
+// touches only one or two cache lines.
+//
+// Elements can be removed, too.  Rather than leaving a marker behind
+// (which would lengthen every later scan that passes over it), removal
+// shifts the elements after it backward into the gap, as far as they
+// can go without moving before their own hashed index, so every scan
+// still stops at the first empty element.
+//
+// The array's capacity is always a power of two, and it doubles whenever
+// more than 7/8 of it would be full.  Because the hash function given to
+// a FlatHashSet might not spread its values evenly (especially in their
+// low bits), each hash is scrambled with a multiplication before it's
+// used.
+
+#ifndef FLATHASHSET_HPP
+#define FLATHASHSET_HPP
+
+#include <functional>
+#include <new>
+#include "Set.hpp"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+
+
+template <typename ElementType, typename Hasher = std::function<unsigned int(const ElementType&)>>
+class FlatHashSet : public Set<ElementType>
+{
+public:
+    // The default capacity of the FlatHashSet before anything has been
+    // added to it.
+    static constexpr unsigned int DEFAULT_CAPACITY = 16;
+
+    // A HashFunction is a function that takes a reference to a const
+    // ElementType and returns an unsigned int.  As in HashSet, it's a
+    // std::function unless a function object type is given as the Hasher,
+    // in which case the compiler can inline it into the probing.
+    using HashFunction = Hasher;
+
+public:
+    // Initializes a FlatHashSet to be empty, so that it will use the given
+    // hash function whenever it needs to hash an element.
+    explicit FlatHashSet(HashFunction hashFunction);
+
+    // Cleans up the FlatHashSet so that it leaks no memory.
+    ~FlatHashSet() noexcept override;
+
+    // Initializes a new FlatHashSet to be a copy of an existing one.
+    FlatHashSet(const FlatHashSet& s);
+
+    // Initializes a new FlatHashSet whose contents are moved from an
+    // expiring one.
+    FlatHashSet(FlatHashSet&& s) noexcept;
+
+    // Assigns an existing FlatHashSet into another.
+    FlatHashSet& operator=(const FlatHashSet& s);
+
+    // Assigns an expiring FlatHashSet into another.
+    FlatHashSet& operator=(FlatHashSet&& s) noexcept;
+
+
+    bool isImplemented() const noexcept override;
+
+
+    // add() adds an element to the set.  If the element is already in the
+    // set, this function has no effect.  When more than 7/8 of the array
+    // would be full, the array's capacity doubles first, which takes linear
+    // time; otherwise, this runs in constant time (assuming a good hash
+    // function).
+    void add(const ElementType& element) override;
+
+
+    // contains() returns true if the given element is already in the set,
+    // false otherwise.  This function runs in constant time (assuming a
+    // good hash function).
+    bool contains(const ElementType& element) const override;
+
+
+    // remove() removes an element from the set, returning true, or returns
+    // false if it wasn't in the set.  This function runs in constant time
+    // (assuming a good hash function).
+    bool remove(const ElementType& element);
+
+
+    // size() returns the number of elements in the set.
+    unsigned int size() const noexcept override;
+
+
+    // capacity() returns the number of elements that the array can hold.
+    unsigned int capacity() const noexcept;
+
+
+private:
+    // The control bytes are scanned this many at a time.
+    static constexpr unsigned int GROUP_SIZE = 16;
+
+    // The control byte of an empty element.  Those of full elements hold
+    // 7 bits of the element's hash, so they're never negative.
+    static constexpr signed char EMPTY = -128;
+
+    struct Slot
+    {
+        alignas(ElementType) unsigned char storage[sizeof(ElementType)];
+    };
+
+    HashFunction hashFunction;
+
+    // control[i] describes slots[i].  So that a group of control bytes can
+    // be loaded starting anywhere, even near the end of the array, the
+    // first GROUP_SIZE - 1 of them are repeated after the last one.
+    signed char * control;
+    Slot * slots;
+    unsigned int arrayCapacity;
+    unsigned int arrayElements;
+
+    // The number of bits in an index into the array.
+    unsigned int indexBits;
+
+    // Initializes an empty FlatHashSet with the given capacity, which
+    // must be a power of two no less than GROUP_SIZE.
+    FlatHashSet(HashFunction hashFunction, unsigned int capacity);
+
+    unsigned long long scramble(const ElementType& element) const;
+    unsigned int homeIndex(unsigned long long scrambled) const noexcept;
+    static signed char controlByte(unsigned long long scrambled) noexcept;
+
+    bool find(const ElementType& element, unsigned long long scrambled, unsigned int& index) const;
+    unsigned int findEmpty(unsigned long long scrambled) const noexcept;
+
+    ElementType& elementAt(unsigned int index) const noexcept;
+    void setControl(unsigned int index, signed char value) noexcept;
+
+    void allocate(unsigned int newCapacity);
+    void destroyAll() noexcept;
+    void grow();
+
+    static unsigned int matching(const signed char* group, signed char value) noexcept;
+};
+
+
+
+template <typename ElementType, typename Hasher>
+FlatHashSet<ElementType, Hasher>::FlatHashSet(HashFunction hashFunction)
+    : FlatHashSet{hashFunction, DEFAULT_CAPACITY}
+{
+}
+
+
+template <typename ElementType, typename Hasher>
+FlatHashSet<ElementType, Hasher>::FlatHashSet(HashFunction hashFunction, unsigned int capacity)
+    : hashFunction{hashFunction}, control{nullptr}, slots{nullptr},
+      arrayCapacity{0}, arrayElements{0}, indexBits{0}
+{
+    allocate(capacity);
+}
+
+
+template <typename ElementType, typename Hasher>
+FlatHashSet<ElementType, Hasher>::~FlatHashSet() noexcept
+{
+    destroyAll();
+}
+
+
+template <typename ElementType, typename Hasher>
+FlatHashSet<ElementType, Hasher>::FlatHashSet(const FlatHashSet& s)
+    : hashFunction{s.hashFunction}, control{nullptr}, slots{nullptr},
+      arrayCapacity{0}, arrayElements{0}, indexBits{0}
+{
+    allocate(s.arrayCapacity);
+
+    //Elements are copied to the same indexes, so nothing needs rehashing;
+    //each control byte is only set once its element has been copied, so
+    //that if a copy fails, destroyAll() knows which ones to destroy
+    try {
+        for (unsigned int i = 0; i < arrayCapacity; ++i) {
+            if (s.control[i] != EMPTY) {
+                new (slots[i].storage) ElementType(s.elementAt(i));
+                setControl(i, s.control[i]);
+                arrayElements++;
+            }
+        }
+    } catch (...) {
+        destroyAll();
+        throw;
+    }
+}
+
+
+template <typename ElementType, typename Hasher>
+FlatHashSet<ElementType, Hasher>::FlatHashSet(FlatHashSet&& s) noexcept
+    : hashFunction{s.hashFunction}, control{s.control}, slots{s.slots},
+      arrayCapacity{s.arrayCapacity}, arrayElements{s.arrayElements}, indexBits{s.indexBits}
+{
+    s.control = nullptr;
+    s.slots = nullptr;
+    s.arrayCapacity = 0;
+    s.arrayElements = 0;
+    s.indexBits = 0;
+}
+
+
+template <typename ElementType, typename Hasher>
+FlatHashSet<ElementType, Hasher>& FlatHashSet<ElementType, Hasher>::operator=(const FlatHashSet& s)
+{
+    if (this != &s) {
+        FlatHashSet copy{s};
+        *this = static_cast<FlatHashSet&&>(copy);
+    }
+    return *this;
+}
+
+
+template <typename ElementType, typename Hasher>
+FlatHashSet<ElementType, Hasher>& FlatHashSet<ElementType, Hasher>::operator=(FlatHashSet&& s) noexcept
+{
+    HashFunction tempFunction = hashFunction;
+    hashFunction = s.hashFunction;
+    s.hashFunction = tempFunction;
+
+    signed char * tempControl = control;
+    control = s.control;
+    s.control = tempControl;
+
+    Slot * tempSlots = slots;
+    slots = s.slots;
+    s.slots = tempSlots;
+
+    unsigned int temp = arrayCapacity;
+    arrayCapacity = s.arrayCapacity;
+    s.arrayCapacity = temp;
+
+    temp = arrayElements;
+    arrayElements = s.arrayElements;
+    s.arrayElements = temp;
+
+    temp = indexBits;
+    indexBits = s.indexBits;
+    s.indexBits = temp;
+
+    return *this;
+}
+
+
+template <typename ElementType, typename Hasher>
+bool FlatHashSet<ElementType, Hasher>::isImplemented() const noexcept
+{
+    return true;
+}
+
+
+template <typename ElementType, typename Hasher>
+void FlatHashSet<ElementType, Hasher>::add(const ElementType& element)
+{
+    //A set that's been moved from has no array; it gets one again here
+    if (arrayCapacity == 0) {
+        allocate(DEFAULT_CAPACITY);
+    }
+
+    unsigned long long scrambled = scramble(element);
+    unsigned int index;
+
+    if (find(element, scrambled, index)) {
+        return;
+    }
+
+    if ((arrayElements + 1) * 8 > arrayCapacity * 7) {
+        grow();
+    }
+
+    index = findEmpty(scrambled);
+    new (slots[index].storage) ElementType(element);
+
+    setControl(index, controlByte(scrambled));
+    arrayElements++;
+}
+
+
+template <typename ElementType, typename Hasher>
+bool FlatHashSet<ElementType, Hasher>::contains(const ElementType& element) const
+{
+    if (arrayElements == 0) {
+        return false;
+    }
+
+    unsigned int index;
+    return find(element, scramble(element), index);
+}
+
+
+template <typename ElementType, typename Hasher>
+bool FlatHashSet<ElementType, Hasher>::remove(const ElementType& element)
+{
+    if (arrayElements == 0) {
+        return false;
+    }
+
+    unsigned int gap;
+    if (!find(element, scramble(element), gap)) {
+        return false;
+    }
+
+    elementAt(gap).~ElementType();
+    setControl(gap, EMPTY);
+    arrayElements--;
+
+    //Each element after the gap (up to the next empty one) moves back into
+    //it, unless that would put it before its own home index; the gap then
+    //moves to where that element was
+    unsigned int mask = arrayCapacity - 1;
+
+    for (unsigned int next = (gap + 1) & mask; control[next] != EMPTY; next = (next + 1) & mask) {
+        unsigned int home = homeIndex(scramble(elementAt(next)));
+
+        //Whether home is cyclically within (gap, next], in which case the
+        //element can't move back as far as the gap
+        bool homeAfterGap = ((next - home) & mask) < ((next - gap) & mask);
+
+        if (!homeAfterGap) {
+            new (slots[gap].storage) ElementType(static_cast<ElementType&&>(elementAt(next)));
+            elementAt(next).~ElementType();
+            setControl(gap, control[next]);
+            setControl(next, EMPTY);
+            gap = next;
+        }
+    }
+
+    return true;
+}
+
+
+template <typename ElementType, typename Hasher>
+unsigned int FlatHashSet<ElementType, Hasher>::size() const noexcept
+{
+    return arrayElements;
+}
+
+
+template <typename ElementType, typename Hasher>
+unsigned int FlatHashSet<ElementType, Hasher>::capacity() const noexcept
+{
+    return arrayCapacity;
+}
+
+
+//Hashes an element and scrambles the hash, so that all of its bits
+//affect both the index and the control byte that are taken from it
+template <typename ElementType, typename Hasher>
+unsigned long long FlatHashSet<ElementType, Hasher>::scramble(const ElementType& element) const
+{
+    return static_cast<unsigned long long>(hashFunction(element)) * 0x9E3779B97F4A7C15ull;
+}
+
+
+//The index is taken from the top bits of the scrambled hash, which are
+//the ones that depend on all of the bits of the hash
+template <typename ElementType, typename Hasher>
+unsigned int FlatHashSet<ElementType, Hasher>::homeIndex(unsigned long long scrambled) const noexcept
+{
+    return static_cast<unsigned int>(scrambled >> (64 - indexBits));
+}
+
+
+template <typename ElementType, typename Hasher>
+signed char FlatHashSet<ElementType, Hasher>::controlByte(unsigned long long scrambled) noexcept
+{
+    return static_cast<signed char>((scrambled >> 25) & 0x7f);
+}
+
+
+//Scans forward from the element's home index, a group of control bytes
+//at a time, for an element equal to the given one, stopping at the
+//first empty element
+template <typename ElementType, typename Hasher>
+bool FlatHashSet<ElementType, Hasher>::find(
+    const ElementType& element, unsigned long long scrambled, unsigned int& index) const
+{
+    unsigned int mask = arrayCapacity - 1;
+    signed char wanted = controlByte(scrambled);
+
+    for (unsigned int start = homeIndex(scrambled); ; start = (start + GROUP_SIZE) & mask) {
+        unsigned int matches = matching(control + start, wanted);
+        unsigned int empties = matching(control + start, EMPTY);
+
+        //Matches after the first empty element belong to other elements'
+        //runs, so they're not worth comparing
+        if (empties != 0) {
+            matches &= (empties & -empties) - 1;
+        }
+
+        while (matches != 0) {
+            unsigned int candidate = (start + __builtin_ctz(matches)) & mask;
+            if (elementAt(candidate) == element) {
+                index = candidate;
+                return true;
+            }
+            matches &= matches - 1;
+        }
+
+        if (empties != 0) {
+            return false;
+        }
+    }
+}
+
+
+//Finds the first empty element at or after the home index of an element
+//with the given scrambled hash, which is where that element belongs
+template <typename ElementType, typename Hasher>
+unsigned int FlatHashSet<ElementType, Hasher>::findEmpty(unsigned long long scrambled) const noexcept
+{
+    unsigned int mask = arrayCapacity - 1;
+
+    for (unsigned int start = homeIndex(scrambled); ; start = (start + GROUP_SIZE) & mask) {
+        unsigned int empties = matching(control + start, EMPTY);
+        if (empties != 0) {
+            return (start + __builtin_ctz(empties)) & mask;
+        }
+    }
+}
+
+
+template <typename ElementType, typename Hasher>
+ElementType& FlatHashSet<ElementType, Hasher>::elementAt(unsigned int index) const noexcept
+{
+    return *reinterpret_cast<ElementType*>(slots[index].storage);
+}
+
+
+template <typename ElementType, typename Hasher>
+void FlatHashSet<ElementType, Hasher>::setControl(unsigned int index, signed char value) noexcept
+{
+    control[index] = value;
+
+    if (index < GROUP_SIZE - 1) {
+        control[arrayCapacity + index] = value;
+    }
+}
+
+
+//Replaces the arrays (which must not hold any elements) with empty ones
+//of the given capacity, which must be a power of two no less than
+//GROUP_SIZE
+template <typename ElementType, typename Hasher>
+void FlatHashSet<ElementType, Hasher>::allocate(unsigned int newCapacity)
+{
+    signed char * newControl = new signed char[newCapacity + GROUP_SIZE - 1];
+    Slot * newSlots;
+
+    try {
+        newSlots = new Slot[newCapacity];
+    } catch (...) {
+        delete[] newControl;
+        throw;
+    }
+
+    for (unsigned int i = 0; i < newCapacity + GROUP_SIZE - 1; ++i) {
+        newControl[i] = EMPTY;
+    }
+
+    delete[] control;
+    delete[] slots;
+
+    control = newControl;
+    slots = newSlots;
+    arrayCapacity = newCapacity;
+    indexBits = 0;
+    while ((1u << indexBits) < newCapacity) {
+        indexBits++;
+    }
+}
+
+
+template <typename ElementType, typename Hasher>
+void FlatHashSet<ElementType, Hasher>::destroyAll() noexcept
+{
+    for (unsigned int i = 0; i < arrayCapacity; ++i) {
+        if (control[i] != EMPTY) {
+            elementAt(i).~ElementType();
+        }
+    }
+
+    delete[] control;
+    delete[] slots;
+    control = nullptr;
+    slots = nullptr;
+    arrayCapacity = 0;
+    arrayElements = 0;
+}
+
+
+//Doubles the capacity, moving every element into the new array.  Every
+//element is hashed before anything is moved, so that if the hash function
+//throws, nothing has changed.  The new set is made first, so that if its
+//allocation throws, there's nothing else to clean up.
+template <typename ElementType, typename Hasher>
+void FlatHashSet<ElementType, Hasher>::grow()
+{
+    FlatHashSet bigger{hashFunction, arrayCapacity * 2};
+    unsigned long long * scrambledHashes = new unsigned long long[arrayCapacity];
+
+    try {
+        for (unsigned int i = 0; i < arrayCapacity; ++i) {
+            if (control[i] != EMPTY) {
+                scrambledHashes[i] = scramble(elementAt(i));
+            }
+        }
+    } catch (...) {
+        delete[] scrambledHashes;
+        throw;
+    }
+
+    for (unsigned int i = 0; i < arrayCapacity; ++i) {
+        if (control[i] != EMPTY) {
+            unsigned int index = bigger.findEmpty(scrambledHashes[i]);
+            new (bigger.slots[index].storage) ElementType(static_cast<ElementType&&>(elementAt(i)));
+            bigger.setControl(index, control[i]);
+            bigger.arrayElements++;
+        }
+    }
+
+    delete[] scrambledHashes;
+    *this = static_cast<FlatHashSet&&>(bigger);
+}
+
+
+//Returns a bit mask with bit i set if group[i] is the given value
+template <typename ElementType, typename Hasher>
+unsigned int FlatHashSet<ElementType, Hasher>::matching(const signed char* group, signed char value) noexcept
+{
+#ifdef __SSE2__
+    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+    return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(value))));
+#else
+    unsigned int mask = 0;
+    for (unsigned int i = 0; i < GROUP_SIZE; ++i) {
+        if (group[i] == value) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+#endif
+}
+
+
+
+#endif // FLATHASHSET_HPP
@@ -14,6 +14,20 @@
 // elements as there are array cells), the HashSet should be resized so
 // that it is twice as large as it was before.
 //
+// How the elements get from the old array into the new one depends on the
+// HashSet's ResizeMode.  By default, they all move during the add() that
+// triggers the resizing, which makes that one add() take time linear in
+// the size of the set.  In the Incremental mode, only the elements in a
+// few of the old array's cells move then, with a few more cells' worth
+// moving during each add() afterward; until the old array is empty,
+// lookups search whichever of the two arrays an element would be in.
+// That keeps every add() about as fast as every other one, which matters
+// more than the total time when, say, the set is filling up while
+// someone's waiting on it.
+//
+// Either way, elements move by relinking their nodes into the new array,
+// so resizing allocates nothing but the new array itself.
+//
 // You are not permitted to use the containers in the C++ Standard Library
 // (such as std::set, std::map, or std::vector) to store the information
 // in your data structure.  Instead, you'll need to use a dynamically-
@@ -28,7 +42,7 @@
 
 
 
-template <typename ElementType>
+template <typename ElementType, typename Hasher = std::function<unsigned int(const ElementType&)>>
 class HashSet : public Set<ElementType>
 {
 public:
@@ -36,14 +50,35 @@ public:
     // added to it.
     static constexpr unsigned int DEFAULT_CAPACITY = 10;
 
+    // The number of cells of the old array whose elements move into the
+    // new one during each add() while an incremental resizing is in
+    // progress.  Resizing from a capacity of c to 2c + 1 leaves room for
+    // about 0.8c more elements before the next resizing, while emptying
+    // the old array takes only c / MIGRATION_STEP calls to add().
+    static constexpr int MIGRATION_STEP = 8;
+
     // A HashFunction is a function that takes a reference to a const
-    // ElementType and returns an unsigned int.
-    using HashFunction = std::function<unsigned int(const ElementType&)>;
+    // ElementType and returns an unsigned int.  By default, it's a
+    // std::function, so any such function can be used, but then every
+    // hash is computed through an indirect call.  Giving a function
+    // object type as the Hasher instead (as in HashSet<std::string,
+    // WordMixStringHash>) lets the compiler inline it into add() and
+    // contains().
+    using HashFunction = Hasher;
+
+    // A ResizeMode says whether a HashSet moves all of its elements into
+    // a larger array at once or a few at a time.
+    enum class ResizeMode
+    {
+        AllAtOnce,
+        Incremental
+    };
 
 public:
     // Initializes a HashSet to be empty, so that it will use the given
-    // hash function whenever it needs to hash an element.
-    explicit HashSet(HashFunction hashFunction);
+    // hash function whenever it needs to hash an element, and resize in
+    // the given way.
+    explicit HashSet(HashFunction hashFunction, ResizeMode resizeMode = ResizeMode::AllAtOnce);
 
     // Cleans up the HashSet so that it leaks no memory.
     ~HashSet() noexcept override;
@@ -74,10 +109,10 @@ public:
     //
     //     capacity * 2 + 1
     //
-    // In the case where the array is resized, this function runs in linear
-    // time (with respect to the number of elements, assuming a good hash
-    // function); otherwise, it runs in constant time (again, assuming a good
-    // hash function).  The amortized running time is also constant.
+    // In the case where the array is resized all at once, this function runs
+    // in linear time (with respect to the number of elements, assuming a good
+    // hash function); otherwise, it runs in constant time (again, assuming a
+    // good hash function).  The amortized running time is also constant.
     void add(const ElementType& element) override;
 
 
@@ -93,7 +128,9 @@ public:
 
     // elementsAtIndex() returns the number of elements that hashed to a
     // particular index in the array.  If the index is out of the boundaries
-    // of the array, this function returns 0.
+    // of the array, this function returns 0.  While an incremental resizing
+    // is in progress, elements that haven't yet moved into the array aren't
+    // counted.
     unsigned int elementsAtIndex(unsigned int index) const;
 
 
@@ -103,8 +140,18 @@ public:
     bool isElementAtIndex(const ElementType& element, unsigned int index) const;
 
 
+    // capacity() returns the number of cells in the array.
+    unsigned int capacity() const noexcept;
+
+
+    // isResizing() returns true if an incremental resizing is in progress,
+    // i.e., some elements are still in the old array.
+    bool isResizing() const noexcept;
+
+
 private:
     HashFunction hashFunction;
+    ResizeMode resizeMode;
 
     struct Node
     {
@@ -115,24 +162,28 @@ private:
     Node **hashArray;
     int hashArrayCapacity;
     int hashArrayElements;
-    void addToArray(Node **arrayToAdd, const ElementType& element);
-};
-
 
+    // While an incremental resizing is in progress, oldArray is the array
+    // whose elements are moving into hashArray, and the cells before
+    // oldArrayMigrated have already been emptied.  Otherwise, it's nullptr.
+    Node **oldArray;
+    int oldArrayCapacity;
+    int oldArrayMigrated;
+
+    bool isInChain(const Node* chain, const ElementType& element) const;
+    bool containsHashed(const ElementType& element, unsigned int hashValue) const;
+    void addToArray(Node *node, unsigned int hashValue);
+    void startResizing();
+    void migrate(int cells);
+    void deleteArray(Node **array, int capacity) noexcept;
+};
 
-namespace impl_
-{
-    template <typename ElementType>
-    unsigned int HashSet__undefinedHashFunction(const ElementType& element)
-    {
-        return 0;
-    }
-}
 
 
-template <typename ElementType>
-HashSet<ElementType>::HashSet(HashFunction hashFunction)
-    : hashFunction{hashFunction}
+template <typename ElementType, typename Hasher>
+HashSet<ElementType, Hasher>::HashSet(HashFunction hashFunction, ResizeMode resizeMode)
+    : hashFunction{hashFunction}, resizeMode{resizeMode},
+      oldArray{nullptr}, oldArrayCapacity{0}, oldArrayMigrated{0}
 {
     hashArray = new Node*[DEFAULT_CAPACITY];
     hashArrayCapacity = DEFAULT_CAPACITY;
@@ -144,28 +195,19 @@ HashSet<ElementType>::HashSet(HashFunction hashFunction)
 }
 
 
-template <typename ElementType>
-HashSet<ElementType>::~HashSet() noexcept
+template <typename ElementType, typename Hasher>
+HashSet<ElementType, Hasher>::~HashSet() noexcept
 {
-    for (int i = 0; i < hashArrayCapacity; ++i) {
-        Node* current = hashArray[i];
-        Node* next;
-        while (current != nullptr) {
-            next = current->next;
-            delete current;
-            current = next;
-        }
-    }
-
-    delete[] hashArray;
+    deleteArray(hashArray, hashArrayCapacity);
+    deleteArray(oldArray, oldArrayCapacity);
 }
 
 
-template <typename ElementType>
-HashSet<ElementType>::HashSet(const HashSet& s)
-    : hashFunction{impl_::HashSet__undefinedHashFunction<ElementType>}
+template <typename ElementType, typename Hasher>
+HashSet<ElementType, Hasher>::HashSet(const HashSet& s)
+    : hashFunction{s.hashFunction}, resizeMode{s.resizeMode},
+      oldArray{nullptr}, oldArrayCapacity{0}, oldArrayMigrated{0}
 {
-    hashFunction = s.hashFunction;
 
     hashArray = new Node*[s.hashArrayCapacity];
     hashArrayCapacity = s.hashArrayCapacity;
@@ -175,24 +217,31 @@ HashSet<ElementType>::HashSet(const HashSet& s)
         hashArray[i] = nullptr;
     }
 
-    for (int i = 0; i < hashArrayCapacity; ++i) {
-        if (s.hashArray[i] != nullptr) {
-            Node * temp = s.hashArray[i];
-            while (temp != nullptr) {
-                add(temp->element);
-                temp = temp->next;
+    //The copy gets all of the elements in its one array, including any
+    //that haven't yet moved out of s's old array
+    try {
+        for (int i = 0; i < s.hashArrayCapacity; ++i) {
+            for (Node * temp = s.hashArray[i]; temp != nullptr; temp = temp->next) {
+                addToArray(new Node{temp->element, nullptr}, hashFunction(temp->element));
             }
         }
+
+        for (int i = s.oldArrayMigrated; i < s.oldArrayCapacity; ++i) {
+            for (Node * temp = s.oldArray[i]; temp != nullptr; temp = temp->next) {
+                addToArray(new Node{temp->element, nullptr}, hashFunction(temp->element));
+            }
+        }
+    } catch (...) {
+        deleteArray(hashArray, hashArrayCapacity);
+        throw;
     }
 }
 
 
-template <typename ElementType>
-HashSet<ElementType>::HashSet(HashSet&& s) noexcept
-    : hashFunction{impl_::HashSet__undefinedHashFunction<ElementType>}
+template <typename ElementType, typename Hasher>
+HashSet<ElementType, Hasher>::HashSet(HashSet&& s) noexcept
+    : hashFunction{s.hashFunction}, resizeMode{s.resizeMode}
 {
-    hashFunction = s.hashFunction;
-    s.hashFunction = NULL;
 
     hashArray = s.hashArray;
     s.hashArray = nullptr;
@@ -202,49 +251,40 @@ HashSet<ElementType>::HashSet(HashSet&& s) noexcept
 
     hashArrayElements = s.hashArrayElements;
     s.hashArrayElements = 0;
-}
 
+    oldArray = s.oldArray;
+    s.oldArray = nullptr;
 
-template <typename ElementType>
-HashSet<ElementType>& HashSet<ElementType>::operator=(const HashSet& s)
-{
-    //Delete everything in hashArray
-    for (int i = 0; i < hashArrayCapacity; i++)
-    {
-        if (hashArray[i] != nullptr) {
-            while (hashArray[i] != nullptr) {
-                Node * toDelete = hashArray[i];
-                hashArray[i] = hashArray[i]->next;
-                delete toDelete;
-            }
-        }
-    }
+    oldArrayCapacity = s.oldArrayCapacity;
+    s.oldArrayCapacity = 0;
 
-    //Copy everything over
-    hashFunction = s.hashFunction;
-    hashArrayCapacity = s.hashArrayCapacity;
-    hashArrayElements = 0;
+    oldArrayMigrated = s.oldArrayMigrated;
+    s.oldArrayMigrated = 0;
+}
 
-    for (int i = 0; i < hashArrayCapacity; ++i) {
-        if (s.hashArray[i] != nullptr) {
-            Node * temp = s.hashArray[i];
-            while (temp != nullptr) {
-                add(temp->element);
-                temp = temp->next;
-            }
-        }
+
+template <typename ElementType, typename Hasher>
+HashSet<ElementType, Hasher>& HashSet<ElementType, Hasher>::operator=(const HashSet& s)
+{
+    if (this != &s) {
+        HashSet copy{s};
+        *this = static_cast<HashSet&&>(copy);
     }
     return * this;
 }
 
 
-template <typename ElementType>
-HashSet<ElementType>& HashSet<ElementType>::operator=(HashSet&& s) noexcept
+template <typename ElementType, typename Hasher>
+HashSet<ElementType, Hasher>& HashSet<ElementType, Hasher>::operator=(HashSet&& s) noexcept
 {
     HashFunction tempFunction = hashFunction;
     hashFunction = s.hashFunction;
     s.hashFunction = tempFunction;
 
+    ResizeMode tempMode = resizeMode;
+    resizeMode = s.resizeMode;
+    s.resizeMode = tempMode;
+
     Node ** tempArray = hashArray;
     hashArray = s.hashArray;
     s.hashArray = tempArray;
@@ -257,86 +297,77 @@ HashSet<ElementType>& HashSet<ElementType>::operator=(HashSet&& s) noexcept
     hashArrayElements = s.hashArrayElements;
     s.hashArrayElements = tempArrayElements;
 
+    Node ** tempOldArray = oldArray;
+    oldArray = s.oldArray;
+    s.oldArray = tempOldArray;
+
+    int tempOldCapacity = oldArrayCapacity;
+    oldArrayCapacity = s.oldArrayCapacity;
+    s.oldArrayCapacity = tempOldCapacity;
+
+    int tempOldMigrated = oldArrayMigrated;
+    oldArrayMigrated = s.oldArrayMigrated;
+    s.oldArrayMigrated = tempOldMigrated;
+
     return *this;
 }
 
 
-template <typename ElementType>
-bool HashSet<ElementType>::isImplemented() const noexcept
+template <typename ElementType, typename Hasher>
+bool HashSet<ElementType, Hasher>::isImplemented() const noexcept
 {
     return true;
 }
 
 
-template <typename ElementType>
-void HashSet<ElementType>::add(const ElementType& element)
+template <typename ElementType, typename Hasher>
+void HashSet<ElementType, Hasher>::add(const ElementType& element)
 {
-    if (!contains(element)) {
+    if (oldArray != nullptr) {
+        migrate(MIGRATION_STEP);
+    }
+
+    unsigned int hashValue = hashFunction(element);
+
+    if (!containsHashed(element, hashValue)) {
         if (static_cast<double>(hashArrayElements)/hashArrayCapacity > .8) {
-            int newCapacity = hashArrayCapacity * 2 + 1;
-            Node ** newHashArray = new Node*[newCapacity];
-            for (int i = 0; i < newCapacity; ++i) {
-                newHashArray[i] = nullptr;
-            }
-            //Rehash the old hashArray
-            hashArrayElements = 0;
-            for (int i = 0; i < hashArrayCapacity; ++i) {
-                if (hashArray[i] != nullptr) {
-                    Node * temp = hashArray[i];
-                    Node * tempNext;
-                    while (temp != nullptr) {
-                        tempNext = temp->next;
-                        addToArray(newHashArray, temp->element);
-                        delete temp;
-                        temp = tempNext;
-                    }
-                }
+            //MIGRATION_STEP is large enough that the last resizing will
+            //have finished by now, but if not, it finishes before the
+            //next one starts
+            if (oldArray != nullptr) {
+                migrate(oldArrayCapacity);
             }
-            //Add new element
-            addToArray(newHashArray, element);
-            hashArrayCapacity = newCapacity;
-            //Remove old hashArray
-            delete[] hashArray;
-            //Point to new hashArray
-            hashArray = newHashArray;
-        } else {
-            addToArray(hashArray, element);
+
+            startResizing();
+            migrate(resizeMode == ResizeMode::AllAtOnce ? oldArrayCapacity : MIGRATION_STEP);
         }
+
+        addToArray(new Node{element, nullptr}, hashValue);
     }
 }
 
 
-template <typename ElementType>
-bool HashSet<ElementType>::contains(const ElementType& element) const
+template <typename ElementType, typename Hasher>
+bool HashSet<ElementType, Hasher>::contains(const ElementType& element) const
 {
-    unsigned int hashValue = hashFunction(element);
-
-    int hashIndex = hashValue % hashArrayCapacity;
-
-    Node * temp = hashArray[hashIndex];
-
-    if (temp != nullptr) {
-        while (temp != nullptr) {
-            if (temp->element == element) {return true;}
-            temp = temp->next;
-        }
-        return false;
-    } else {
-        return false;
-    }
+    return containsHashed(element, hashFunction(element));
 }
 
 
-template <typename ElementType>
-unsigned int HashSet<ElementType>::size() const noexcept
+template <typename ElementType, typename Hasher>
+unsigned int HashSet<ElementType, Hasher>::size() const noexcept
 {
     return hashArrayElements;
 }
 
 
-template <typename ElementType>
-unsigned int HashSet<ElementType>::elementsAtIndex(unsigned int index) const
+template <typename ElementType, typename Hasher>
+unsigned int HashSet<ElementType, Hasher>::elementsAtIndex(unsigned int index) const
 {
+    if (index >= static_cast<unsigned int>(hashArrayCapacity)) {
+        return 0;
+    }
+
     unsigned int count = 0;
 
     Node * temp = hashArray[index];
@@ -349,40 +380,137 @@ unsigned int HashSet<ElementType>::elementsAtIndex(unsigned int index) const
 }
 
 
-template <typename ElementType>
-bool HashSet<ElementType>::isElementAtIndex(const ElementType& element, unsigned int index) const
+template <typename ElementType, typename Hasher>
+bool HashSet<ElementType, Hasher>::isElementAtIndex(const ElementType& element, unsigned int index) const
 {
-    Node * temp = hashArray[index];
-    while (temp != nullptr) {
+    if (index >= static_cast<unsigned int>(hashArrayCapacity)) {
+        return false;
+    }
+
+    return isInChain(hashArray[index], element);
+}
+
+
+template <typename ElementType, typename Hasher>
+unsigned int HashSet<ElementType, Hasher>::capacity() const noexcept
+{
+    return hashArrayCapacity;
+}
+
+
+template <typename ElementType, typename Hasher>
+bool HashSet<ElementType, Hasher>::isResizing() const noexcept
+{
+    return oldArray != nullptr;
+}
+
+
+template <typename ElementType, typename Hasher>
+bool HashSet<ElementType, Hasher>::isInChain(const Node* chain, const ElementType& element) const
+{
+    for (const Node * temp = chain; temp != nullptr; temp = temp->next) {
         if (temp->element == element) {return true;}
-        temp = temp->next;
     }
     return false;
 }
 
-template<typename ElementType>
-void HashSet<ElementType>::addToArray(HashSet::Node **arrayToAdd, const ElementType &element) {
-    Node * tempNode = new Node;
-    tempNode->element = element;
-    tempNode->next = nullptr;
 
-    unsigned int hashValue = hashFunction(element);
+//Looks for an element in the cell of hashArray it hashes to and, if it
+//hashes to a cell of oldArray that hasn't been emptied yet, in that one
+template <typename ElementType, typename Hasher>
+bool HashSet<ElementType, Hasher>::containsHashed(const ElementType& element, unsigned int hashValue) const
+{
+    if (isInChain(hashArray[hashValue % hashArrayCapacity], element)) {
+        return true;
+    }
+
+    if (oldArray != nullptr) {
+        int oldIndex = hashValue % oldArrayCapacity;
+        return oldIndex >= oldArrayMigrated && isInChain(oldArray[oldIndex], element);
+    }
+
+    return false;
+}
 
+
+template <typename ElementType, typename Hasher>
+void HashSet<ElementType, Hasher>::addToArray(Node *node, unsigned int hashValue)
+{
     int hashIndex = hashValue % hashArrayCapacity;
 
-    if (elementsAtIndex(hashIndex) > 0) {
-        Node * temp = hashArray[hashIndex];
-        while (temp->next != nullptr) {
-            temp = temp->next;
+    node->next = hashArray[hashIndex];
+    hashArray[hashIndex] = node;
+    hashArrayElements++;
+}
+
+
+//Replaces hashArray with an empty one of the next larger capacity, which
+//the elements will move into from what's now oldArray
+template <typename ElementType, typename Hasher>
+void HashSet<ElementType, Hasher>::startResizing()
+{
+    int newCapacity = hashArrayCapacity * 2 + 1;
+    Node ** newHashArray = new Node*[newCapacity];
+    for (int i = 0; i < newCapacity; ++i) {
+        newHashArray[i] = nullptr;
+    }
+
+    oldArray = hashArray;
+    oldArrayCapacity = hashArrayCapacity;
+    oldArrayMigrated = 0;
+
+    hashArray = newHashArray;
+    hashArrayCapacity = newCapacity;
+}
+
+
+//Moves the elements in the next few cells of oldArray into hashArray,
+//deleting oldArray once it's empty
+template <typename ElementType, typename Hasher>
+void HashSet<ElementType, Hasher>::migrate(int cells)
+{
+    int end = oldArrayMigrated + cells;
+    if (end > oldArrayCapacity) {
+        end = oldArrayCapacity;
+    }
+
+    //Each node is hashed before it's unlinked, so if the hash function
+    //throws, every element is still in one array or the other
+    for (; oldArrayMigrated < end; ++oldArrayMigrated) {
+        while (oldArray[oldArrayMigrated] != nullptr) {
+            Node * temp = oldArray[oldArrayMigrated];
+            unsigned int hashValue = hashFunction(temp->element);
+
+            oldArray[oldArrayMigrated] = temp->next;
+            hashArrayElements--;
+            addToArray(temp, hashValue);
         }
-        temp->next = tempNode;
-        hashArrayElements++;
-    } else {
-        arrayToAdd[hashIndex] = tempNode;
-        hashArrayElements++;
+    }
+
+    if (oldArrayMigrated == oldArrayCapacity) {
+        delete[] oldArray;
+        oldArray = nullptr;
+        oldArrayCapacity = 0;
+        oldArrayMigrated = 0;
     }
 }
 
 
-#endif // HASHSET_HPP
+template <typename ElementType, typename Hasher>
+void HashSet<ElementType, Hasher>::deleteArray(Node **array, int capacity) noexcept
+{
+    for (int i = 0; i < capacity; ++i) {
+        Node* current = array[i];
+        Node* next;
+        while (current != nullptr) {
+            next = current->next;
+            delete current;
+            current = next;
+        }
+    }
 
+    delete[] array;
+}
+
+
+#endif // HASHSET_HPP
@@ -0,0 +1,205 @@
+// ConcurrentHashSetTests.cpp
+//
+// ICS 46 Spring 2020
+// Project #4: Set the Controls for the Heart of the Sun
+//
+// Unit tests for ConcurrentHashSet, including ones in which several
+// threads add and look up elements at once.
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "ConcurrentHashSet.hpp"
+
+
+namespace
+{
+    unsigned int identityHash(const int& i)
+    {
+        return static_cast<unsigned int>(i);
+    }
+
+
+    unsigned int lengthHash(const std::string& s)
+    {
+        return s.length();
+    }
+}
+
+
+TEST(ConcurrentHashSetTests, isImplemented)
+{
+    ConcurrentHashSet<int> s{identityHash};
+    Set<int>& ss = s;
+    EXPECT_TRUE(ss.isImplemented());
+}
+
+
+TEST(ConcurrentHashSetTests, containsOnlyElementsAdded)
+{
+    ConcurrentHashSet<std::string> s{lengthHash};
+    s.add("Boo");
+    s.add("Foo");
+    s.add("Boo");
+    s.add("Blah");
+
+    EXPECT_EQ(3, s.size());
+    EXPECT_TRUE(s.contains("Boo"));
+    EXPECT_TRUE(s.contains("Foo"));
+    EXPECT_TRUE(s.contains("Blah"));
+    EXPECT_FALSE(s.contains("Bar"));
+}
+
+
+TEST(ConcurrentHashSetTests, containsEverythingAfterGrowing)
+{
+    ConcurrentHashSet<int> s{identityHash};
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        s.add(i);
+    }
+
+    EXPECT_EQ(10000, s.size());
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        EXPECT_TRUE(s.contains(i));
+    }
+
+    EXPECT_FALSE(s.contains(10000));
+}
+
+
+TEST(ConcurrentHashSetTests, frozenSetsContainTheSameElements)
+{
+    ConcurrentHashSet<int> s{identityHash, 1000};
+
+    for (int i = 0; i < 1000; i += 2)
+    {
+        s.add(i);
+    }
+
+    EXPECT_FALSE(s.isFrozen());
+    s.freeze();
+    EXPECT_TRUE(s.isFrozen());
+    s.freeze();
+
+    EXPECT_EQ(500, s.size());
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        EXPECT_EQ(i % 2 == 0, s.contains(i));
+    }
+}
+
+
+TEST(ConcurrentHashSetTests, cannotAddToFrozenSets)
+{
+    ConcurrentHashSet<int> s{identityHash};
+    s.add(1);
+    s.freeze();
+
+    EXPECT_THROW(s.add(2), ConcurrentHashSet<int>::FrozenException);
+    EXPECT_THROW(s.add(1), ConcurrentHashSet<int>::FrozenException);
+    EXPECT_EQ(1, s.size());
+}
+
+
+TEST(ConcurrentHashSetTests, emptySetsCanBeFrozen)
+{
+    ConcurrentHashSet<std::string> s{lengthHash};
+    s.freeze();
+
+    EXPECT_EQ(0, s.size());
+    EXPECT_FALSE(s.contains("Boo"));
+}
+
+
+TEST(ConcurrentHashSetTests, threadsCanAddAtOnce)
+{
+    ConcurrentHashSet<int> s{identityHash};
+    std::vector<std::thread> threads;
+
+    // Each element is added by two threads, so some adds are duplicates
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back(
+            [&s, t]()
+            {
+                for (int i = 0; i < 20000; ++i)
+                {
+                    s.add((t / 2) * 20000 + i);
+                }
+            });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(40000, s.size());
+
+    for (int i = 0; i < 40000; ++i)
+    {
+        EXPECT_TRUE(s.contains(i));
+    }
+}
+
+
+TEST(ConcurrentHashSetTests, readersSeeElementsAddedBeforeTheyLook)
+{
+    ConcurrentHashSet<int> s{identityHash};
+    std::atomic<int> added{0};
+    std::atomic<bool> missing{false};
+
+    std::thread writer{
+        [&s, &added]()
+        {
+            for (int i = 0; i < 50000; ++i)
+            {
+                s.add(i);
+                added.store(i + 1, std::memory_order_release);
+            }
+        }};
+
+    std::vector<std::thread> readers;
+
+    for (int t = 0; t < 3; ++t)
+    {
+        readers.emplace_back(
+            [&s, &added, &missing]()
+            {
+                while (added.load(std::memory_order_acquire) < 50000)
+                {
+                    int known = added.load(std::memory_order_acquire);
+
+                    for (int i = known - 1; i >= 0 && i >= known - 100; --i)
+                    {
+                        if (!s.contains(i))
+                        {
+                            missing = true;
+                        }
+                    }
+
+                    if (s.contains(60000))
+                    {
+                        missing = true;
+                    }
+                }
+            });
+    }
+
+    writer.join();
+
+    for (std::thread& reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_FALSE(missing);
+    EXPECT_EQ(50000, s.size());
+}
@@ -0,0 +1,245 @@
+// FlatHashSetTests.cpp
+//
+// ICS 46 Spring 2020
+// Project #4: Set the Controls for the Heart of the Sun
+//
+// Unit tests for FlatHashSet, including ones that check it against a
+// std::set over long random sequences of additions and removals.
+
+#include <random>
+#include <set>
+#include <string>
+#include <gtest/gtest.h>
+#include "FlatHashSet.hpp"
+
+
+namespace
+{
+    template <typename T>
+    unsigned int zeroHash(const T&)
+    {
+        return 0;
+    }
+
+
+    unsigned int identityHash(const int& i)
+    {
+        return static_cast<unsigned int>(i);
+    }
+
+
+    unsigned int lengthHash(const std::string& s)
+    {
+        return s.length();
+    }
+}
+
+
+TEST(FlatHashSetTests, isImplemented)
+{
+    FlatHashSet<int> s{identityHash};
+    Set<int>& ss = s;
+    EXPECT_TRUE(ss.isImplemented());
+}
+
+
+TEST(FlatHashSetTests, startsEmpty)
+{
+    FlatHashSet<int> s{identityHash};
+    EXPECT_EQ(0, s.size());
+    EXPECT_EQ(FlatHashSet<int>::DEFAULT_CAPACITY, s.capacity());
+    EXPECT_FALSE(s.contains(0));
+}
+
+
+TEST(FlatHashSetTests, containsOnlyElementsAdded)
+{
+    FlatHashSet<int> s{identityHash};
+    s.add(11);
+    s.add(1);
+    s.add(5);
+
+    EXPECT_EQ(3, s.size());
+    EXPECT_TRUE(s.contains(11));
+    EXPECT_TRUE(s.contains(1));
+    EXPECT_TRUE(s.contains(5));
+    EXPECT_FALSE(s.contains(21));
+    EXPECT_FALSE(s.contains(2));
+}
+
+
+TEST(FlatHashSetTests, addingDuplicatesHasNoEffect)
+{
+    FlatHashSet<std::string> s{lengthHash};
+    s.add("Boo");
+    s.add("Boo");
+    s.add("Foo");
+    s.add("Foo");
+
+    EXPECT_EQ(2, s.size());
+}
+
+
+TEST(FlatHashSetTests, growsPastSevenEighthsFull)
+{
+    FlatHashSet<int> s{identityHash};
+
+    for (int i = 0; i < 14; ++i)
+    {
+        s.add(i);
+    }
+
+    EXPECT_EQ(16, s.capacity());
+
+    s.add(14);
+    EXPECT_EQ(32, s.capacity());
+
+    for (int i = 0; i < 15; ++i)
+    {
+        EXPECT_TRUE(s.contains(i));
+    }
+}
+
+
+TEST(FlatHashSetTests, collidingElementsAreAllFound)
+{
+    FlatHashSet<int> s{zeroHash<int>};
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        s.add(i * 7);
+    }
+
+    EXPECT_EQ(1000, s.size());
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        EXPECT_TRUE(s.contains(i * 7));
+        EXPECT_FALSE(s.contains(i * 7 + 1));
+    }
+}
+
+
+TEST(FlatHashSetTests, removingCollidingElementsKeepsTheRestFindable)
+{
+    FlatHashSet<int> s{zeroHash<int>};
+
+    for (int i = 0; i < 100; ++i)
+    {
+        s.add(i);
+    }
+
+    for (int i = 0; i < 100; i += 3)
+    {
+        EXPECT_TRUE(s.remove(i));
+        EXPECT_FALSE(s.remove(i));
+    }
+
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(i % 3 != 0, s.contains(i));
+    }
+
+    EXPECT_EQ(66, s.size());
+}
+
+
+TEST(FlatHashSetTests, copiesAreIndependent)
+{
+    FlatHashSet<std::string> s1{lengthHash};
+    s1.add("Boo");
+    s1.add("Foo");
+
+    FlatHashSet<std::string> s2{s1};
+    s2.add("Blah");
+    s1.remove("Boo");
+
+    EXPECT_FALSE(s1.contains("Boo"));
+    EXPECT_TRUE(s2.contains("Boo"));
+    EXPECT_FALSE(s1.contains("Blah"));
+    EXPECT_TRUE(s2.contains("Blah"));
+
+    s1 = s2;
+    s2.remove("Foo");
+
+    EXPECT_EQ(3, s1.size());
+    EXPECT_TRUE(s1.contains("Foo"));
+}
+
+
+TEST(FlatHashSetTests, movedFromSetsCanBeReused)
+{
+    FlatHashSet<std::string> s1{lengthHash};
+    s1.add("Boo");
+
+    FlatHashSet<std::string> s2{std::move(s1)};
+    EXPECT_TRUE(s2.contains("Boo"));
+
+    s1.add("Foo");
+    EXPECT_TRUE(s1.contains("Foo"));
+    EXPECT_FALSE(s1.contains("Boo"));
+
+    FlatHashSet<std::string> s3{lengthHash};
+    s3 = std::move(s2);
+    EXPECT_TRUE(s3.contains("Boo"));
+    EXPECT_EQ(1, s3.size());
+}
+
+
+TEST(FlatHashSetTests, agreesWithStdSetOverRandomAddsAndRemoves)
+{
+    std::mt19937 random{46};
+    std::uniform_int_distribution<int> value{0, 2000};
+    std::uniform_int_distribution<int> operation{0, 2};
+
+    // Hashing to only a few distinct values makes long runs of colliding
+    // elements, which is where removal is most likely to go wrong
+    FlatHashSet<int> s{[](const int& i) { return static_cast<unsigned int>(i % 37); }};
+    std::set<int> expected;
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        int v = value(random);
+
+        if (operation(random) == 0)
+        {
+            EXPECT_EQ(expected.erase(v) == 1, s.remove(v));
+        }
+        else
+        {
+            s.add(v);
+            expected.insert(v);
+        }
+
+        ASSERT_EQ(expected.size(), s.size());
+    }
+
+    for (int v = 0; v <= 2000; ++v)
+    {
+        EXPECT_EQ(expected.count(v) == 1, s.contains(v));
+    }
+}
+
+
+TEST(FlatHashSetTests, canUseFunctionObjectsAsHashers)
+{
+    struct LengthHash
+    {
+        unsigned int operator()(const std::string& s) const
+        {
+            return s.length();
+        }
+    };
+
+    FlatHashSet<std::string, LengthHash> s1{LengthHash{}};
+    s1.add("Boo");
+    s1.add("Blah");
+
+    FlatHashSet<std::string, LengthHash> s2{s1};
+    s2.remove("Boo");
+    s1 = std::move(s2);
+
+    EXPECT_EQ(1, s1.size());
+    EXPECT_TRUE(s1.contains("Blah"));
+    EXPECT_FALSE(s1.contains("Boo"));
+}
@@ -0,0 +1,228 @@
+// HashSetTests.cpp
+//
+// ICS 46 Spring 2020
+// Project #4: Set the Controls for the Heart of the Sun
+//
+// Unit tests for HashSet beyond the sanity checks, mainly of how it
+// resizes, both all at once and incrementally.
+
+#include <random>
+#include <set>
+#include <string>
+#include <gtest/gtest.h>
+#include "HashSet.hpp"
+
+
+namespace
+{
+    unsigned int identityHash(const int& i)
+    {
+        return static_cast<unsigned int>(i);
+    }
+
+
+    using Mode = HashSet<int>::ResizeMode;
+}
+
+
+TEST(HashSetTests, containsEverythingAfterResizingAllAtOnce)
+{
+    HashSet<int> s{identityHash};
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        s.add(i);
+        EXPECT_FALSE(s.isResizing());
+    }
+
+    EXPECT_EQ(1000, s.size());
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        EXPECT_TRUE(s.contains(i));
+    }
+
+    EXPECT_FALSE(s.contains(1000));
+}
+
+
+TEST(HashSetTests, elementsMoveToTheirNewIndexesWhenResizing)
+{
+    HashSet<int> s{identityHash};
+
+    for (int i = 0; i < 9; ++i)
+    {
+        s.add(i);
+    }
+
+    // Capacity is now 21
+    EXPECT_TRUE(s.isElementAtIndex(0, 0));
+    EXPECT_TRUE(s.isElementAtIndex(8, 8));
+    EXPECT_EQ(0, s.elementsAtIndex(9));
+
+    s.add(30);
+    EXPECT_TRUE(s.isElementAtIndex(30, 9));
+    EXPECT_EQ(1, s.elementsAtIndex(9));
+}
+
+
+TEST(HashSetTests, indexesOutsideTheArrayHoldNothing)
+{
+    HashSet<int> s{identityHash};
+    s.add(1);
+
+    EXPECT_EQ(10, s.capacity());
+    EXPECT_EQ(0, s.elementsAtIndex(10));
+    EXPECT_FALSE(s.isElementAtIndex(1, 11));
+}
+
+
+TEST(HashSetTests, lookupsSearchBothArraysWhileResizingIncrementally)
+{
+    HashSet<int> s{identityHash, Mode::Incremental};
+
+    for (int i = 0; i < 9; ++i)
+    {
+        s.add(i);
+    }
+
+    EXPECT_FALSE(s.isResizing());
+
+    // Growing from 10 to 21 moves only the first MIGRATION_STEP cells
+    s.add(9);
+    EXPECT_TRUE(s.isResizing());
+    EXPECT_EQ(10, s.size());
+
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_TRUE(s.contains(i));
+    }
+
+    // Adding a duplicate still moves a step's worth of cells
+    s.add(0);
+    EXPECT_FALSE(s.isResizing());
+    EXPECT_EQ(10, s.size());
+
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_TRUE(s.isElementAtIndex(i, i));
+    }
+}
+
+
+TEST(HashSetTests, incrementalResizingFinishesBeforeTheNextOneStarts)
+{
+    HashSet<int> s{identityHash, Mode::Incremental};
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        s.add(i * 3);
+    }
+
+    EXPECT_EQ(100000, s.size());
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        EXPECT_TRUE(s.contains(i * 3));
+        EXPECT_FALSE(s.contains(i * 3 + 1));
+    }
+}
+
+
+TEST(HashSetTests, copiesTakeElementsNotYetMoved)
+{
+    HashSet<int> s1{identityHash, Mode::Incremental};
+
+    for (int i = 0; i < 10; ++i)
+    {
+        s1.add(i);
+    }
+
+    ASSERT_TRUE(s1.isResizing());
+
+    HashSet<int> s2{s1};
+    EXPECT_FALSE(s2.isResizing());
+    EXPECT_EQ(10, s2.size());
+
+    HashSet<int> s3{identityHash};
+    s3.add(100);
+    s3 = s1;
+    EXPECT_EQ(10, s3.size());
+    EXPECT_FALSE(s3.contains(100));
+
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_TRUE(s2.contains(i));
+        EXPECT_TRUE(s3.contains(i));
+    }
+
+    HashSet<int> s4{std::move(s1)};
+    EXPECT_TRUE(s4.isResizing());
+    s4.add(10);
+
+    for (int i = 0; i <= 10; ++i)
+    {
+        EXPECT_TRUE(s4.contains(i));
+    }
+}
+
+
+TEST(HashSetTests, bothModesAgreeWithStdSet)
+{
+    std::mt19937 random{46};
+    std::uniform_int_distribution<int> value{0, 50000};
+
+    HashSet<std::string> allAtOnce{[](const std::string& s) { return static_cast<unsigned int>(s.length() * 31 + s[0]); }};
+    HashSet<std::string> incremental{
+        [](const std::string& s) { return static_cast<unsigned int>(s.length() * 31 + s[0]); },
+        HashSet<std::string>::ResizeMode::Incremental};
+    std::set<std::string> expected;
+
+    for (int i = 0; i < 5000; ++i)
+    {
+        std::string element = std::to_string(value(random));
+        allAtOnce.add(element);
+        incremental.add(element);
+        expected.insert(element);
+
+        ASSERT_EQ(expected.size(), allAtOnce.size());
+        ASSERT_EQ(expected.size(), incremental.size());
+    }
+
+    for (int i = 0; i <= 50000; i += 7)
+    {
+        std::string element = std::to_string(i);
+        EXPECT_EQ(expected.count(element) == 1, allAtOnce.contains(element));
+        EXPECT_EQ(expected.count(element) == 1, incremental.contains(element));
+    }
+}
+
+
+TEST(HashSetTests, canUseFunctionObjectsAsHashers)
+{
+    struct ModuloHash
+    {
+        unsigned int operator()(const int& i) const
+        {
+            return static_cast<unsigned int>(i) % 7;
+        }
+    };
+
+    HashSet<int, ModuloHash> s1{ModuloHash{}, HashSet<int, ModuloHash>::ResizeMode::Incremental};
+
+    for (int i = 0; i < 100; ++i)
+    {
+        s1.add(i);
+    }
+
+    HashSet<int, ModuloHash> s2{s1};
+    HashSet<int, ModuloHash> s3{std::move(s1)};
+    s1 = s2;
+
+    EXPECT_EQ(100, s1.size());
+    EXPECT_EQ(100, s2.size());
+    EXPECT_EQ(100, s3.size());
+    EXPECT_TRUE(s1.contains(99));
+    EXPECT_FALSE(s3.contains(100));
+    EXPECT_TRUE(s2.isElementAtIndex(7, 0));
+}
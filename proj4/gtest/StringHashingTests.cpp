@@ -0,0 +1,83 @@
+// StringHashingTests.cpp
+//
+// ICS 46 Spring 2020
+// Project #4: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the string hash functions that read more than one
+// character at a time.
+
+#include <set>
+#include <string>
+#include <gtest/gtest.h>
+#include "StringHashing.hpp"
+
+
+TEST(StringHashingTests, crc32MatchesTheStandardCheckValue)
+{
+    EXPECT_EQ(0xe3069283u, hashStringAsCrc32("123456789"));
+    EXPECT_EQ(0u, hashStringAsCrc32(""));
+}
+
+
+TEST(StringHashingTests, crc32IsTheSameForLongAndShortTails)
+{
+    // These read as one eight-byte word plus a tail of each length
+    std::string text = "ABCDEFGHIJKLMNOP";
+    std::set<unsigned int> hashes;
+
+    for (size_t length = 0; length <= text.length(); ++length)
+    {
+        hashes.insert(hashStringAsCrc32(text.substr(0, length)));
+    }
+
+    EXPECT_EQ(text.length() + 1, hashes.size());
+}
+
+
+TEST(StringHashingTests, wordMixSeparatesAnagrams)
+{
+    EXPECT_EQ(hashStringAsSum("LISTEN"), hashStringAsSum("SILENT"));
+    EXPECT_NE(hashStringAsWordMix("LISTEN"), hashStringAsWordMix("SILENT"));
+    EXPECT_NE(hashStringAsWordMix("ABCDEFGHIJ"), hashStringAsWordMix("ABCDEFGHJI"));
+}
+
+
+TEST(StringHashingTests, wordMixSeparatesStringsEndingInZeroes)
+{
+    // The tail is padded with zeroes, so the length must matter too
+    EXPECT_NE(hashStringAsWordMix(std::string("A", 1)), hashStringAsWordMix(std::string("A\0", 2)));
+    EXPECT_NE(hashStringAsWordMix(""), hashStringAsWordMix(std::string("\0", 1)));
+}
+
+
+TEST(StringHashingTests, wordMixSpreadsSimilarWords)
+{
+    std::set<unsigned int> hashes;
+
+    for (char first = 'A'; first <= 'Z'; ++first)
+    {
+        for (char second = 'A'; second <= 'Z'; ++second)
+        {
+            hashes.insert(hashStringAsWordMix(std::string{"WORD"} + first + second) % 1024);
+        }
+    }
+
+    // 676 words into 1024 cells; a good hash fills well over 400 of them
+    EXPECT_GT(hashes.size(), 400u);
+}
+
+
+TEST(StringHashingTests, functionObjectsGiveKnownHashes)
+{
+    // The CRC-32C values were checked against a bit-at-a-time CRC; the
+    // word mix values pin down its output on both multiply paths
+    EXPECT_EQ(0x5d1bbefcu, WordMixStringHash{}(""));
+    EXPECT_EQ(0x76a15aabu, WordMixStringHash{}("A"));
+    EXPECT_EQ(0xdf6844a6u, WordMixStringHash{}("LISTEN"));
+    EXPECT_EQ(0x695612c9u, WordMixStringHash{}("ABCDEFGHIJKLMNOPQRSTUVWXYZ"));
+
+    EXPECT_EQ(0x00000000u, Crc32StringHash{}(""));
+    EXPECT_EQ(0xe16dcdeeu, Crc32StringHash{}("A"));
+    EXPECT_EQ(0x073fa504u, Crc32StringHash{}("LISTEN"));
+    EXPECT_EQ(0x319897cdu, Crc32StringHash{}("ABCDEFGHIJKLMNOPQRSTUVWXYZ"));
+}
@@ -0,0 +1,156 @@
+// HashReport.cpp
+//
+// ICS 46 Spring 2020
+// Project #4: Set the Controls for the Heart of the Sun
+
+#include <iomanip>
+#include "HashReport.hpp"
+#include "HashSet.hpp"
+#include "Stopwatch.hpp"
+#include "StringHashing.hpp"
+
+
+
+namespace
+{
+    struct NamedHashFunction
+    {
+        const char* name;
+        unsigned int (*function)(const std::string&);
+    };
+
+
+    // The zero hash function is left out, since every word would be in
+    // the same cell, and looking them up would take hours for a long list.
+    const NamedHashFunction hashFunctions[] = {
+        {"SUM", hashStringAsSum},
+        {"PRODUCT", hashStringAsProduct},
+        {"WORDMIX", hashStringAsWordMix},
+        {"CRC32", hashStringAsCrc32}
+    };
+
+
+    // Cells holding this many words or more are counted together.
+    const unsigned int longChain = 8;
+
+
+    // Hashing is timed for at least this long, in microseconds, so the
+    // clock's resolution doesn't matter.
+    const double minimumTimingDuration = 200000.0;
+
+
+    void printHistogram(
+        std::ostream& out, const char* name, unsigned int (*function)(const std::string&),
+        const std::vector<std::string>& words)
+    {
+        HashSet<std::string> wordSet{function};
+
+        for (const std::string& word : words)
+        {
+            wordSet.add(word);
+        }
+
+        unsigned int cells[longChain + 1] = {};
+        unsigned int longest = 0;
+
+        for (unsigned int i = 0; i < wordSet.capacity(); ++i)
+        {
+            unsigned int count = wordSet.elementsAtIndex(i);
+            cells[count < longChain ? count : longChain]++;
+
+            if (count > longest)
+            {
+                longest = count;
+            }
+        }
+
+        out << std::left << std::setw(10) << name << std::right;
+
+        for (unsigned int count : cells)
+        {
+            out << std::setw(9) << count;
+        }
+
+        out << std::setw(9) << longest << std::endl;
+    }
+
+
+    void printThroughput(
+        std::ostream& out, const char* name, unsigned int (*function)(const std::string&),
+        const std::vector<std::string>& words)
+    {
+        unsigned long long bytes = 0;
+        for (const std::string& word : words)
+        {
+            bytes += word.length();
+        }
+
+        Stopwatch stopwatch;
+        double duration = 0.0;
+        unsigned long long rounds = 0;
+
+        // The hashes are combined into a result that's kept, so the
+        // compiler can't skip computing them
+        volatile unsigned int combined = 0;
+
+        while (duration < minimumTimingDuration)
+        {
+            unsigned int roundCombined = 0;
+
+            stopwatch.start();
+
+            for (const std::string& word : words)
+            {
+                roundCombined ^= function(word);
+            }
+
+            stopwatch.stop();
+
+            combined = combined ^ roundCombined;
+            duration += stopwatch.lastDuration();
+            rounds++;
+        }
+
+        double megabytesPerSecond = bytes * rounds / duration;
+        double nanosecondsPerWord = duration * 1000.0 / (words.size() * rounds);
+
+        out << std::left << std::setw(10) << name << std::right
+            << std::fixed << std::setprecision(1)
+            << std::setw(12) << megabytesPerSecond << " MB/s"
+            << std::setw(12) << nanosecondsPerWord << " ns/word" << std::endl;
+    }
+}
+
+
+
+void printHashReport(std::ostream& out, const std::vector<std::string>& words)
+{
+    if (words.empty())
+    {
+        return;
+    }
+
+    out << std::endl;
+    out << "CELLS HOLDING EACH NUMBER OF WORDS" << std::endl;
+    out << "Function  ";
+
+    for (unsigned int count = 0; count < longChain; ++count)
+    {
+        out << std::setw(9) << count;
+    }
+
+    out << std::setw(8) << longChain << "+" << std::setw(9) << "Longest" << std::endl;
+
+    for (const NamedHashFunction& hashFunction : hashFunctions)
+    {
+        printHistogram(out, hashFunction.name, hashFunction.function, words);
+    }
+
+    out << std::endl;
+    out << "HASHING THROUGHPUT" << std::endl;
+
+    for (const NamedHashFunction& hashFunction : hashFunctions)
+    {
+        printThroughput(out, hashFunction.name, hashFunction.function, words);
+    }
+}
@@ -0,0 +1,27 @@
+// HashReport.hpp
+//
+// ICS 46 Spring 2020
+// Project #4: Set the Controls for the Heart of the Sun
+//
+// A hash report compares the string hash functions in StringHashing.hpp
+// on a list of words.  For each function, it stores the words in a
+// HashSet and counts how many cells of its array hold no words, one word,
+// two words, and so on -- a well-spread hash function leaves few cells
+// holding more than two or three -- then measures how quickly the
+// function hashes the words, in millions of bytes per second and
+// nanoseconds per word.
+
+#ifndef HASHREPORT_HPP
+#define HASHREPORT_HPP
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+
+
+void printHashReport(std::ostream& out, const std::vector<std::string>& words);
+
+
+
+#endif // HASHREPORT_HPP
@@ -11,6 +11,8 @@
 #include "SpellCheckShell.hpp"
 #include "AVLSet.hpp"
 #include "EmptySet.hpp"
+#include "FlatHashSet.hpp"
+#include "HashReport.hpp"
 #include "HashSet.hpp"
 #include "ListSet.hpp"
 #include "OutputSpellCheckerListener.hpp"
@@ -70,6 +72,34 @@ namespace
         {
             return std::make_unique<HashSet<std::string>>(hashStringAsProduct);
         }
+        else if (setType == "HASH WORDMIX")
+        {
+            return std::make_unique<HashSet<std::string, WordMixStringHash>>(WordMixStringHash{});
+        }
+        else if (setType == "HASH CRC32")
+        {
+            return std::make_unique<HashSet<std::string, Crc32StringHash>>(Crc32StringHash{});
+        }
+        else if (setType == "FLAT HASH ZERO")
+        {
+            return std::make_unique<FlatHashSet<std::string>>(hashStringAsZero);
+        }
+        else if (setType == "FLAT HASH SUM")
+        {
+            return std::make_unique<FlatHashSet<std::string>>(hashStringAsSum);
+        }
+        else if (setType == "FLAT HASH PRODUCT")
+        {
+            return std::make_unique<FlatHashSet<std::string>>(hashStringAsProduct);
+        }
+        else if (setType == "FLAT HASH WORDMIX")
+        {
+            return std::make_unique<FlatHashSet<std::string, WordMixStringHash>>(WordMixStringHash{});
+        }
+        else if (setType == "FLAT HASH CRC32")
+        {
+            return std::make_unique<FlatHashSet<std::string, Crc32StringHash>>(Crc32StringHash{});
+        }
         else if (setType == "LIST")
         {
             return std::make_unique<ListSet<std::string>>();
@@ -112,7 +142,8 @@ namespace
     enum class OutputType
     {
         Display,
-        TimeOnly
+        TimeOnly,
+        HashReport
     };
 
 
@@ -126,6 +157,10 @@ namespace
         {
             return OutputType::TimeOnly;
         }
+        else if (outputType == "HASHES")
+        {
+            return OutputType::HashReport;
+        }
         else
         {
             throw SpellCheckShell::ShellException{"Invalid output type: " + outputType};
@@ -276,6 +311,19 @@ namespace
 
         std::cout << std::endl;
     }
+
+
+    // The hash report compares the hash functions themselves, so it
+    // doesn't use the word set or the text file.
+    void runHashReport(const std::string& wordFilePath)
+    {
+        std::cout << std::endl;
+        std::cout << "Loading words from " << wordFilePath << " ..." << std::endl;
+
+        std::vector<std::string> words = WordSetLoader{}.load(wordFilePath);
+
+        printHashReport(std::cout, words);
+    }
 }
 
 
@@ -307,6 +355,10 @@ void SpellCheckShell::run()
     case OutputType::TimeOnly:
         runTimingTest(*wordSet, wordFilePath, textFilePath);
         break;
+
+    case OutputType::HashReport:
+        runHashReport(wordFilePath);
+        break;
     }
 }
 
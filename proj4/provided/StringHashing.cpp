@@ -50,3 +50,27 @@ unsigned int hashStringAsProduct(const std::string& word)
     return hash;
 }
 
+
+// This hash function reads the string eight bytes at a time, rather than
+// one, and mixes each eight-byte word into the hash with one 64-bit
+// multiplication, in the style of wyhash.  Every bit of every character
+// affects every bit of the result, so strings that differ only in the
+// order of their characters (which collide in hashStringAsSum) or in
+// their last few characters hash very differently.
+
+unsigned int hashStringAsWordMix(const std::string& word)
+{
+    return WordMixStringHash{}(word);
+}
+
+
+// This hash function returns the string's CRC-32C checksum.  Where the
+// SSE4.2 crc32 instruction is available (e.g., when compiling with
+// -msse4.2 or -march=native on a recent x86 processor), it's computed
+// eight bytes at a time with that instruction; otherwise, it's computed
+// a byte at a time from a table.  Both give the same result.
+
+unsigned int hashStringAsCrc32(const std::string& word)
+{
+    return Crc32StringHash{}(word);
+}
@@ -8,13 +8,184 @@
 #ifndef STRINGHASHING_HPP
 #define STRINGHASHING_HPP
 
+#include <cstring>
 #include <string>
 
+#ifdef __SSE4_2__
+#include <nmmintrin.h>
+#endif
+
 
 
 unsigned int hashStringAsZero(const std::string& word);
 unsigned int hashStringAsSum(const std::string& word);
 unsigned int hashStringAsProduct(const std::string& word);
+unsigned int hashStringAsWordMix(const std::string& word);
+unsigned int hashStringAsCrc32(const std::string& word);
+
+
+
+// Function objects that hash strings the same way as hashStringAsWordMix
+// and hashStringAsCrc32.  Given as the Hasher of a HashSet or FlatHashSet
+// (e.g., HashSet<std::string, WordMixStringHash>), they're defined here,
+// rather than in StringHashing.cpp, so the compiler can inline them.
+
+struct WordMixStringHash
+{
+    unsigned int operator()(const std::string& word) const noexcept;
+};
+
+
+struct Crc32StringHash
+{
+    unsigned int operator()(const std::string& word) const noexcept;
+};
+
+
+
+namespace impl_
+{
+    // Reads the eight bytes starting at p as one 64-bit word.
+    inline unsigned long long readWord(const char* p)
+    {
+        unsigned long long word;
+        std::memcpy(&word, p, sizeof(word));
+        return word;
+    }
+
+
+    // Reads the last count (fewer than eight) bytes of a string, starting
+    // at p, as one 64-bit word, with zeroes in place of the missing bytes.
+    inline unsigned long long readTail(const char* p, size_t count)
+    {
+        unsigned long long word = 0;
+        std::memcpy(&word, p, count);
+        return word;
+    }
+
+
+    // Multiplies two 64-bit values into a 128-bit product and folds its
+    // two halves together, so every bit of the result depends on every
+    // bit of both values.
+    inline unsigned long long multiplyAndFold(unsigned long long a, unsigned long long b)
+    {
+#ifdef __SIZEOF_INT128__
+        unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+        return static_cast<unsigned long long>(product) ^ static_cast<unsigned long long>(product >> 64);
+#else
+        unsigned long long aLow = a & 0xffffffff;
+        unsigned long long aHigh = a >> 32;
+        unsigned long long bLow = b & 0xffffffff;
+        unsigned long long bHigh = b >> 32;
+
+        unsigned long long lowLow = aLow * bLow;
+        unsigned long long lowHigh = aLow * bHigh;
+        unsigned long long highLow = aHigh * bLow;
+        unsigned long long highHigh = aHigh * bHigh;
+
+        unsigned long long middle = (lowLow >> 32) + (lowHigh & 0xffffffff) + (highLow & 0xffffffff);
+        unsigned long long low = (lowLow & 0xffffffff) | (middle << 32);
+        unsigned long long high = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+
+        return low ^ high;
+#endif
+    }
+
+
+    // Arbitrary odd constants with about as many one bits as zero bits.
+    constexpr unsigned long long mixSecret0 = 0xa0761d6478bd642full;
+    constexpr unsigned long long mixSecret1 = 0xe7037ed1a0b428dbull;
+    constexpr unsigned long long mixSecret2 = 0x8ebc6af09c88c6e3ull;
+
+
+#ifndef __SSE4_2__
+    // The table for computing a CRC-32C a byte at a time, using the
+    // same (Castagnoli) polynomial as the SSE4.2 crc32 instruction.
+    struct Crc32Table
+    {
+        unsigned int entries[256];
+
+        Crc32Table()
+        {
+            for (unsigned int i = 0; i < 256; ++i)
+            {
+                unsigned int crc = i;
+                for (int bit = 0; bit < 8; ++bit)
+                {
+                    crc = (crc >> 1) ^ ((crc & 1) ? 0x82f63b78u : 0);
+                }
+                entries[i] = crc;
+            }
+        }
+    };
+
+
+    inline const Crc32Table& crc32Table()
+    {
+        static const Crc32Table table;
+        return table;
+    }
+#endif
+}
+
+
+
+inline unsigned int WordMixStringHash::operator()(const std::string& word) const noexcept
+{
+    const char* p = word.data();
+    size_t length = word.length();
+    unsigned long long hash = impl_::mixSecret0 ^ length;
+
+    size_t i = 0;
+
+    for (; i + 8 <= length; i += 8)
+    {
+        hash = impl_::multiplyAndFold(impl_::readWord(p + i) ^ impl_::mixSecret1, hash ^ impl_::mixSecret0);
+    }
+
+    hash = impl_::multiplyAndFold(
+        impl_::readTail(p + i, length - i) ^ impl_::mixSecret1, hash ^ impl_::mixSecret2);
+    hash = impl_::multiplyAndFold(hash ^ impl_::mixSecret2, length ^ impl_::mixSecret1);
+
+    return static_cast<unsigned int>(hash ^ (hash >> 32));
+}
+
+
+inline unsigned int Crc32StringHash::operator()(const std::string& word) const noexcept
+{
+    const char* p = word.data();
+    size_t length = word.length();
+    unsigned int crc = 0xffffffff;
+
+#ifdef __SSE4_2__
+    size_t i = 0;
+
+#ifdef __x86_64__
+    unsigned long long wideCrc = crc;
+
+    for (; i + 8 <= length; i += 8)
+    {
+        wideCrc = _mm_crc32_u64(wideCrc, impl_::readWord(p + i));
+    }
+
+    crc = static_cast<unsigned int>(wideCrc);
+#endif
+
+    for (; i < length; ++i)
+    {
+        crc = _mm_crc32_u8(crc, static_cast<unsigned char>(p[i]));
+    }
+#else
+    const impl_::Crc32Table& table = impl_::crc32Table();
+
+    for (size_t i = 0; i < length; ++i)
+    {
+        crc = (crc >> 8) ^ table.entries[(crc ^ static_cast<unsigned char>(p[i])) & 0xff];
+    }
+#endif
+
+    return ~crc;
+}
 
 
 